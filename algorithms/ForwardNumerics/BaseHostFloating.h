@@ -34,6 +34,11 @@
 #include <cfloat>
 #include "ForwardNumerics/BaseFloating.h"
 
+#if !defined(_WIN32) && !defined(__SUN__) && (defined(__LINUX__) || defined(__linux__))
+#define DefineHostFenv
+#include <cfenv>
+#endif
+
 namespace Numerics {
 
 class DoubleTraits {
@@ -103,6 +108,87 @@ class LongDoubleTraits {
    static bool isValid() { return (UBitSizeExponent <= (int) sizeof(int)*8); }
 };
 
+/* Definition of the class HostRoundingModeGuard */
+// Sets the hardware rounding mode once for a whole sequence of native operations
+//   and restores the previous mode at the end of the scope. Inside the scope,
+//   the operators +=, -=, *=, /= of TFloatingBase round with this mode and the
+//   ...AssignUpward methods compute both bounds with a mode fixed upward.
+//   The callers are compiled with -frounding-math (gcc, clang) to prevent the
+//   compiler from folding -((-a) op b) or from moving operations out of the scope.
+
+class HostRoundingModeGuard {
+  private:
+   int uOldMode;
+
+  public:
+   typedef DDouble::Access::ReadParameters ReadParameters;
+   static int queryMode();
+   static void setMode(int mode);
+   static int getMode(const ReadParameters& params);
+   static int getUpwardMode();
+
+   HostRoundingModeGuard(const ReadParameters& params)
+      :  uOldMode(queryMode()) { setMode(getMode(params)); }
+   explicit HostRoundingModeGuard(int mode)
+      :  uOldMode(queryMode()) { setMode(mode); }
+   HostRoundingModeGuard(const HostRoundingModeGuard&) = delete;
+   HostRoundingModeGuard& operator=(const HostRoundingModeGuard&) = delete;
+   ~HostRoundingModeGuard() { setMode(uOldMode); }
+};
+
+inline int
+HostRoundingModeGuard::queryMode() {
+#ifdef _WIN32
+   return _controlfp(0, 0) & _MCW_RC;
+#elif defined(__SUN__)
+   return fpgetround();
+#elif defined(DefineHostFenv)
+   return fegetround();
+#else
+   return 0;
+#endif
+}
+
+inline void
+HostRoundingModeGuard::setMode(int mode) {
+#ifdef _WIN32
+   _controlfp(mode, _MCW_RC);
+#elif defined(__SUN__)
+   fpsetround((fp_rnd) mode);
+#elif defined(DefineHostFenv)
+   fesetround(mode);
+#endif
+}
+
+inline int
+HostRoundingModeGuard::getMode(const ReadParameters& params) {
+#ifdef _WIN32
+   return params.isLowestRound() ? _RC_DOWN : (params.isHighestRound() ? _RC_UP
+      : (params.isNearestRound() ? _RC_NEAR : _RC_CHOP));
+#elif defined(__SUN__)
+   return params.isLowestRound() ? FP_RM : (params.isHighestRound() ? FP_RP
+      : (params.isNearestRound() ? FP_RN : FP_RZ));
+#elif defined(DefineHostFenv)
+   return params.isLowestRound() ? FE_DOWNWARD : (params.isHighestRound() ? FE_UPWARD
+      : (params.isNearestRound() ? FE_TONEAREST : FE_TOWARDZERO));
+#else
+   return 0;
+#endif
+}
+
+inline int
+HostRoundingModeGuard::getUpwardMode() {
+#ifdef _WIN32
+   return _RC_UP;
+#elif defined(__SUN__)
+   return FP_RP;
+#elif defined(DefineHostFenv)
+   return FE_UPWARD;
+#else
+   return 0;
+#endif
+}
+
 template <class TypeTraits>
 class TFloatingBase {
   public:
@@ -151,6 +237,41 @@ class TFloatingBase {
    thisType& multAssign(const thisType& source, const ReadParameters& params);
    thisType& divAssign(const thisType& source, const ReadParameters& params);
 
+   // to be called within a HostRoundingModeGuard(HostRoundingModeGuard::getUpwardMode()):
+   //   the lowest rounding of a op b is computed as -((-a) op b)
+   thisType& plusAssignUpward(const thisType& source, const ReadParameters& params)
+      {  AssumeCondition(params.isLowestRound() || params.isHighestRound())
+         if (params.isLowestRound())
+            dDouble = -((-dDouble) - source.dDouble);
+         else
+            dDouble += source.dDouble;
+         return *this;
+      }
+   thisType& minusAssignUpward(const thisType& source, const ReadParameters& params)
+      {  AssumeCondition(params.isLowestRound() || params.isHighestRound())
+         if (params.isLowestRound())
+            dDouble = -((-dDouble) + source.dDouble);
+         else
+            dDouble -= source.dDouble;
+         return *this;
+      }
+   thisType& multAssignUpward(const thisType& source, const ReadParameters& params)
+      {  AssumeCondition(params.isLowestRound() || params.isHighestRound())
+         if (params.isLowestRound())
+            dDouble = -((-dDouble) * source.dDouble);
+         else
+            dDouble *= source.dDouble;
+         return *this;
+      }
+   thisType& divAssignUpward(const thisType& source, const ReadParameters& params)
+      {  AssumeCondition(params.isLowestRound() || params.isHighestRound())
+         if (params.isLowestRound())
+            dDouble = -((-dDouble) / source.dDouble);
+         else
+            dDouble /= source.dDouble;
+         return *this;
+      }
+
    thisType& operator-=(const thisType& source)
       {  dDouble -= source.dDouble; return *this; }
    thisType& operator*=(const thisType& source)
@@ -241,7 +362,7 @@ TFloatingBase<TypeTraits>::plusAssign(const thisType& source, const ReadParamete
       fpsetround(FP_RZ);
    dDouble += source.dDouble;
    fpsetround(FP_RN);
-#elif defined(__LINUX__)
+#elif defined(DefineHostFenv)
    if (params.isLowestRound())
       fesetround(FE_DOWNWARD);
    else if (params.isHighestRound())
@@ -286,7 +407,7 @@ TFloatingBase<TypeTraits>::minusAssign(const thisType& source, const ReadParamet
       fpsetround(FP_RZ);
    dDouble -= source.dDouble;
    fpsetround(FP_RN);
-#elif defined(__LINUX__)
+#elif defined(DefineHostFenv)
    if (params.isLowestRound())
       fesetround(FE_DOWNWARD);
    else if (params.isHighestRound())
@@ -331,7 +452,7 @@ TFloatingBase<TypeTraits>::multAssign(const thisType& source, const ReadParamete
       fpsetround(FP_RZ);
    dDouble *= source.dDouble;
    fpsetround(FP_RN);
-#elif defined(__LINUX__)
+#elif defined(DefineHostFenv)
    if (params.isLowestRound())
       fesetround(FE_DOWNWARD);
    else if (params.isHighestRound())
@@ -376,7 +497,7 @@ TFloatingBase<TypeTraits>::divAssign(const thisType& source, const ReadParameter
       fpsetround(FP_RZ);
    dDouble /= source.dDouble;
    fpsetround(FP_RN);
-#elif defined(__LINUX__)
+#elif defined(DefineHostFenv)
    if (params.isLowestRound())
       fesetround(FE_DOWNWARD);
    else if (params.isHighestRound())
@@ -481,6 +602,14 @@ class TDoubleElement : public FloatingBaseTraits, public DDouble::Access {
       {  return (thisType&) inherited::multAssign(source, params); }
    thisType& divAssign(const thisType& source, ReadParameters& params)
       {  return (thisType&) inherited::divAssign(source, params); }
+   thisType& plusAssignUpward(const thisType& source, const ReadParameters& params)
+      {  return (thisType&) inherited::plusAssignUpward(source, params); }
+   thisType& minusAssignUpward(const thisType& source, const ReadParameters& params)
+      {  return (thisType&) inherited::minusAssignUpward(source, params); }
+   thisType& multAssignUpward(const thisType& source, const ReadParameters& params)
+      {  return (thisType&) inherited::multAssignUpward(source, params); }
+   thisType& divAssignUpward(const thisType& source, const ReadParameters& params)
+      {  return (thisType&) inherited::divAssignUpward(source, params); }
 
    thisType& operator-=(const thisType& source)
       {  return (thisType&) inherited::operator-=(source); }
@@ -55,10 +55,15 @@ namespace DInteger {
 class Access {
   public:
    static int log_base_2(uint32_t value)
-      {  int result = 1;
+      {
+#if defined(__GNUC__) || defined(__clang__)
+         return (value != 0) ? (int) (8*sizeof(unsigned int)) - __builtin_clz(value) : 1;
+#else
+         int result = 1;
          while ((value >>= 1) != 0)
             ++result;
          return result;
+#endif
       }
 };
 
@@ -267,6 +272,30 @@ class UnsignedBaseStoreTraits {
          return (shift <= 0) || ((value << (8*sizeof(uint32_t)-shift)) == (uint32_t) 0U);
       }
    static bool isOneValue(uint32_t value) { return value == (uint32_t) 1U; }
+
+   // carry kernels used by the generic multiplication, addition and division of cells
+   static const bool FCarryKernels = true;
+   static uint32_t multExtended(uint32_t first, uint32_t second, uint32_t& high)
+      {  uint64_t result = (uint64_t) first * second;
+         high = (uint32_t) (result >> (sizeof(uint32_t)*8));
+         return (uint32_t) result;
+      }
+   static uint32_t addCarry(uint32_t& cell, uint32_t value, uint32_t carry)
+      {  uint64_t result = (uint64_t) cell + value + carry;
+         cell = (uint32_t) result;
+         return (uint32_t) (result >> (sizeof(uint32_t)*8));
+      }
+   static uint32_t subBorrow(uint32_t& cell, uint32_t value, uint32_t borrow)
+      {  uint64_t result = (uint64_t) cell - value - borrow;
+         cell = (uint32_t) result;
+         return (uint32_t) (result >> (sizeof(uint32_t)*8)) & 0x1U;
+      }
+   // quotient of high*base+low by divisor, with high < divisor
+   static uint32_t divExtended(uint32_t high, uint32_t low, uint32_t divisor, uint32_t& remainder)
+      {  uint64_t numerator = ((uint64_t) high << (sizeof(uint32_t)*8)) | low;
+         remainder = (uint32_t) (numerator % divisor);
+         return (uint32_t) (numerator / divisor);
+      }
    static void writeValue(STG::IOObject::OSBase& out, uint32_t value, bool isRaw)
 #ifndef DefineNoEnhancedObject
       {  out.write(value, isRaw); }
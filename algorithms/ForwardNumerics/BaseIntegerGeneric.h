@@ -31,6 +31,11 @@
 
 #include "ForwardNumerics/BaseIntegerCommon.h"
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <x86intrin.h>
+#define DefineX86CarryIntrinsics
+#endif
+
 namespace Numerics {
 
 class UnsignedLongBaseStoreTraits {
@@ -41,10 +46,15 @@ class UnsignedLongBaseStoreTraits {
    typedef uint64_t& BaseTypeReference;
    typedef uint64_t BaseTypeConstReference;
    static int log_base_2(uint64_t value)
-      {  int result = 1;
+      {
+#if defined(__GNUC__) || defined(__clang__)
+         return (value != 0) ? (int) (8*sizeof(unsigned long long)) - __builtin_clzll(value) : 1;
+#else
+         int result = 1;
          while ((value >>= 1) != 0)
             ++result;
          return result;
+#endif
       }
    static void clearArray(uint64_t* array, int count)
       {  memset(array, 0, count*sizeof(uint64_t)); }
@@ -158,6 +168,88 @@ class UnsignedLongBaseStoreTraits {
          return (shift <= 0) || ((value << (8*sizeof(uint64_t)-shift)) == (uint64_t) 0);
       }
    static bool isOneValue(uint64_t value) { return value == (uint64_t) 1; }
+
+   // carry kernels used by the generic multiplication, addition and division of cells:
+   // 128-bit products and add-with-carry instructions when the compiler provides them
+   static const bool FCarryKernels = true;
+   static uint64_t multExtended(uint64_t first, uint64_t second, uint64_t& high)
+      {
+#ifdef __SIZEOF_INT128__
+         unsigned __int128 result = (unsigned __int128) first * second;
+         high = (uint64_t) (result >> (sizeof(uint64_t)*8));
+         return (uint64_t) result;
+#else
+         uint64_t low = getMidLowPart(first) * getMidLowPart(second);
+         uint64_t firstMiddle = getMidHighPart(first) * getMidLowPart(second) + getMidHighPart(low);
+         uint64_t secondMiddle = getMidLowPart(first) * getMidHighPart(second) + getMidLowPart(firstMiddle);
+         high = getMidHighPart(first) * getMidHighPart(second) + getMidHighPart(firstMiddle)
+            + getMidHighPart(secondMiddle);
+         return getStoreMidHighPart(getMidLowPart(secondMiddle), low);
+#endif
+      }
+   static uint64_t addCarry(uint64_t& cell, uint64_t value, uint64_t carry)
+      {
+#ifdef DefineX86CarryIntrinsics
+         unsigned long long result;
+         uint64_t newCarry = _addcarry_u64((unsigned char) carry, cell, value, &result);
+         cell = result;
+         return newCarry;
+#else
+         cell += value;
+         uint64_t newCarry = (cell < value) ? (uint64_t) 1 : (uint64_t) 0;
+         cell += carry;
+         return newCarry + ((cell < carry) ? (uint64_t) 1 : (uint64_t) 0);
+#endif
+      }
+   static uint64_t subBorrow(uint64_t& cell, uint64_t value, uint64_t borrow)
+      {
+#ifdef DefineX86CarryIntrinsics
+         unsigned long long result;
+         uint64_t newBorrow = _subborrow_u64((unsigned char) borrow, cell, value, &result);
+         cell = result;
+         return newBorrow;
+#else
+         uint64_t newBorrow = (cell < value) ? (uint64_t) 1 : (uint64_t) 0;
+         cell -= value;
+         newBorrow += (cell < borrow) ? (uint64_t) 1 : (uint64_t) 0;
+         cell -= borrow;
+         return newBorrow;
+#endif
+      }
+   // quotient of high*base+low by divisor, with high < divisor
+   static uint64_t divExtended(uint64_t high, uint64_t low, uint64_t divisor, uint64_t& remainder)
+      {
+#ifdef __SIZEOF_INT128__
+         unsigned __int128 numerator = ((unsigned __int128) high << (sizeof(uint64_t)*8)) | low;
+         remainder = (uint64_t) (numerator % divisor);
+         return (uint64_t) (numerator / divisor);
+#else
+         // normalized divisor and two half-cell digits of quotient
+         int shift = (int) (8*sizeof(uint64_t)) - log_base_2(divisor);
+         if (shift > 0) {
+            divisor <<= shift;
+            high = (high << shift) | (low >> (8*sizeof(uint64_t)-shift));
+            low <<= shift;
+         };
+         uint64_t divisorHigh = getMidHighPart(divisor), divisorLow = getMidLowPart(divisor);
+         uint64_t result = 0;
+         for (int digit = 1; digit >= 0; --digit) {
+            uint64_t numeratorDigit = digit ? getMidHighPart(low) : getMidLowPart(low);
+            uint64_t quotient = high / divisorHigh, rest = high % divisorHigh;
+            while ((quotient >> (4*sizeof(uint64_t))) != 0
+                  || quotient*divisorLow > ((rest << (4*sizeof(uint64_t))) | numeratorDigit)) {
+               --quotient;
+               rest += divisorHigh;
+               if ((rest >> (4*sizeof(uint64_t))) != 0)
+                  break;
+            };
+            high = ((high << (4*sizeof(uint64_t))) | numeratorDigit) - quotient*divisor;
+            result = (result << (4*sizeof(uint64_t))) | quotient;
+         };
+         remainder = high >> shift;
+         return result;
+#endif
+      }
    static void writeValue(STG::IOObject::OSBase& out, uint64_t value, bool isRaw)
 #ifdef DefineNoEnhancedObject
       {  if (!isRaw)
@@ -182,6 +274,14 @@ class UnsignedLongBaseStoreTraits {
       }
 };
 
+/* Reference store traits that multiply and add the cells by half-cells with
+   explicit carry detection. They validate the carry kernels of BaseStoreTraits. */
+template <class BaseStoreTraits>
+class TSplitCellStoreTraits : public BaseStoreTraits {
+  public:
+   static const bool FCarryKernels = false;
+};
+
 /* IntegerTraits should conform to DInteger::CellIntegerTraitsContract */
 template <class BaseStoreTraits, class IntegerTraits>
 class TGBigCellInt;
@@ -76,6 +76,9 @@ class TBaseFloatIntervalContract {
    void persist() {}
 };
 
+template <int UMaxBitsNumber, class TypeBaseFloatInterval, class TypeBuiltDouble, typename TypeImplementation>
+class TCompareHostFloatInterval;
+
 template <int UMaxBitsNumber, class TypeBaseFloatInterval, class TypeBuiltDouble, typename TypeImplementation>
 class TCompareFloatInterval : public TypeBaseFloatInterval {
   private:
@@ -94,6 +97,11 @@ class TCompareFloatInterval : public TypeBaseFloatInterval {
 
    template <int MaxBitsNumberArgument, class TypeBaseFloatIntervalArgument, class TypeBuiltDoubleArgument, typename TypeImplementationArgument>
    friend class TCompareFloatInterval;
+   template <int MaxBitsNumberArgument, class TypeBaseFloatIntervalArgument, class TypeBuiltDoubleArgument, typename TypeImplementationArgument>
+   friend class TCompareHostFloatInterval;
+
+   // both bounds of an operation on nonzero points come from a single computation
+   bool isPoint() const { return !bfMin.isZero() && bfMin.compareValue(bfMax) == CREqual; }
 
   public:
    void initFrom(STG::IOObject::ISBase& in);
@@ -395,9 +403,14 @@ TCompareFloatInterval<UMaxBitsNumber, TypeBaseFloatInterval, TypeBuiltDouble, Ty
 #endif
    auto& minParams = inherited::minParams();
    auto& maxParams = inherited::maxParams();
-   bfMin.plusAssign(source.bfMin, minParams);
+   if (isPoint() && source.isPoint())
+      bfMin.plusAssignDual(source.bfMin, bfMax, minParams, maxParams);
+   else {
+      bfMin.plusAssign(source.bfMin, minParams);
+      minParams.clear();
+      bfMax.plusAssign(source.bfMax, maxParams);
+   };
    minParams.clear();
-   bfMax.plusAssign(source.bfMax, maxParams);
    maxParams.clear();
    inherited::notifyForCompare(*this);
    return *this;
@@ -411,9 +424,14 @@ TCompareFloatInterval<UMaxBitsNumber, TypeBaseFloatInterval, TypeBuiltDouble, Ty
 #endif
    auto& minParams = inherited::minParams();
    auto& maxParams = inherited::maxParams();
-   bfMin.minusAssign(source.bfMax, minParams);
+   if (isPoint() && source.isPoint())
+      bfMin.minusAssignDual(source.bfMax, bfMax, minParams, maxParams);
+   else {
+      bfMin.minusAssign(source.bfMax, minParams);
+      minParams.clear();
+      bfMax.minusAssign(source.bfMin, maxParams);
+   };
    minParams.clear();
-   bfMax.minusAssign(source.bfMin, maxParams);
    maxParams.clear();
    inherited::notifyForCompare(*this);
    return *this;
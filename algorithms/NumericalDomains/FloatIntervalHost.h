@@ -0,0 +1,270 @@
+/**************************************************************************/
+/*                                                                        */
+/*  Copyright (C) 2011-2025                                               */
+/*    CEA (Commissariat a l'Energie Atomique et aux Energies              */
+/*         Alternatives)                                                  */
+/*                                                                        */
+/*  you can redistribute it and/or modify it under the terms of the GNU   */
+/*  Lesser General Public License as published by the Free Software       */
+/*  Foundation, version 2.1.                                              */
+/*                                                                        */
+/*  It is distributed in the hope that it will be useful,                 */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         */
+/*  GNU Lesser General Public License for more details.                   */
+/*                                                                        */
+/*  See the GNU Lesser General Public License version 2.1                 */
+/*  for more details (enclosed in the file LICENSE).                      */
+/*                                                                        */
+/**************************************************************************/
+
+/////////////////////////////////
+//
+// Library   : NumericalDomains
+// Unit      : FloatInterval
+// File      : FloatIntervalHost.h
+// Description :
+//   Definition of a class of floating point intervals with native bounds
+//
+
+#pragma once
+
+#include "NumericalDomains/FloatIntervalBase.h"
+#include "ForwardNumerics/BaseHostFloating.h"
+#include <cmath>
+#include <limits>
+
+namespace NumericalDomains { namespace DDoubleInterval {
+
+/*********************************************************************/
+/* Definition of the class TCompareHostFloatInterval                 */
+/*********************************************************************/
+// Same interface as TCompareFloatInterval, but the bounds are stored in the
+//   native format TypeImplementation of the analyzed program. The arithmetic
+//   operations round the bounds outward with the hardware rounding mode, the
+//   comparisons and the conversions between formats step with nextafter.
+//   The operations without a native directed rounding (decimal reads,
+//   integer conversions, transcendental functions) run on a TCompareFloatInterval
+//   whose bounds are converted back outward. The native bounds of an operation
+//   then enclose the TypeBuiltDouble bounds of TCompareFloatInterval.
+//   The arithmetic operations are not inline: only the translation unit of the
+//   explicit instantiations needs -frounding-math.
+
+template <int UMaxBitsNumber, class TypeBaseFloatInterval, class TypeBuiltDouble, typename TypeImplementation>
+class TCompareHostFloatInterval : public TypeBaseFloatInterval {
+  private:
+   typedef TCompareHostFloatInterval<UMaxBitsNumber, TypeBaseFloatInterval, TypeBuiltDouble, TypeImplementation> thisType;
+   typedef TypeBaseFloatInterval inherited;
+   typedef TCompareFloatInterval<UMaxBitsNumber, TypeBaseFloatInterval, TypeBuiltDouble, TypeImplementation> BuiltInterval;
+
+#ifdef FLOAT_CONCRETE
+   TypeImplementation dValue = 0;
+#endif
+   TypeImplementation dMin = 0;
+   TypeImplementation dMax = 0;
+
+   static TypeImplementation previous(TypeImplementation value)
+      {  return std::nextafter(value, -std::numeric_limits<TypeImplementation>::infinity()); }
+   static TypeImplementation next(TypeImplementation value)
+      {  return std::nextafter(value, std::numeric_limits<TypeImplementation>::infinity()); }
+   static bool isApproximate(TypeImplementation value);
+   void adjustMin() { if (isApproximate(dMin)) dMin = previous(dMin); }
+   void adjustMax() { if (isApproximate(dMax)) dMax = next(dMax); }
+
+   BuiltInterval asBuilt() const;
+   static TypeImplementation retrieveBound(const TypeBuiltDouble& bound, bool isUpper);
+   void setFromBuilt(const BuiltInterval& source);
+   void initFromInteger(int64_t value);
+   void initFromInteger(uint64_t value);
+
+   template <int MaxBitsNumberArgument, class TypeBaseFloatIntervalArgument, class TypeBuiltDoubleArgument, typename TypeImplementationArgument>
+   friend class TCompareHostFloatInterval;
+
+  public:
+   void initFrom(STG::IOObject::ISBase& in);
+   void initFrom(TypeImplementation value)
+      {
+#ifdef FLOAT_CONCRETE
+         dValue = value;
+#endif
+         dMin = dMax = value;
+         adjustMin();
+         adjustMax();
+         inherited::notifyForCompare(*this);
+      }
+   void initFromAtomic(TypeImplementation value)
+      {
+#ifdef FLOAT_CONCRETE
+         dValue = value;
+#endif
+         dMin = dMax = value;
+         inherited::notifyForCompare(*this);
+      }
+
+  public:
+   typedef TypeBuiltDouble BuiltDouble;
+   void retrieveRelativeError(TypeBuiltDouble& result) const { asBuilt().retrieveRelativeError(result); }
+
+   TypeBuiltDouble min() const
+      {  TypeBuiltDouble result;
+         DDoubleInterval::fillContent(result, dMin, typename TypeBaseFloatInterval::FloatDigitsHelper());
+         return result;
+      }
+   TypeBuiltDouble max() const
+      {  TypeBuiltDouble result;
+         DDoubleInterval::fillContent(result, dMax, typename TypeBaseFloatInterval::FloatDigitsHelper());
+         return result;
+      }
+
+  public:
+   TCompareHostFloatInterval() = default;
+   TCompareHostFloatInterval(const thisType& source) = default;
+   TCompareHostFloatInterval(TypeImplementation min, TypeImplementation max)
+#ifdef FLOAT_CONCRETE
+      :  dValue((min + max)/2), dMin(min), dMax(max)
+#else
+      :  dMin(min), dMax(max)
+#endif
+      {  adjustMin();
+         adjustMax();
+         inherited::notifyForCompare(*this);
+      }
+   template <typename TypeValue> TCompareHostFloatInterval(TypeValue value) requires std::integral<TypeValue>
+#ifdef FLOAT_CONCRETE
+      :  dValue((TypeImplementation) value)
+#endif
+      {  if (std::is_unsigned<TypeValue>::value)
+            initFromInteger((uint64_t) value);
+         else
+            initFromInteger((int64_t) value);
+         inherited::notifyForCompare(*this);
+      }
+   TCompareHostFloatInterval(thisType&& source) = default;
+   TCompareHostFloatInterval& operator=(const thisType& source) = default;
+   TCompareHostFloatInterval& operator=(thisType&& source) = default;
+
+   void mergeWith(const thisType& source)
+      {
+#ifdef FLOAT_CONCRETE
+         dValue = source.dValue;
+#endif
+         if (dMin > source.dMin)
+            dMin = source.dMin;
+         if (dMax < source.dMax)
+            dMax = source.dMax;
+      }
+   template <class TypeBuiltArgument, typename TypeImplementationArgument>
+   TCompareHostFloatInterval(const TCompareHostFloatInterval<UMaxBitsNumber, TypeBaseFloatInterval, TypeBuiltArgument, TypeImplementationArgument>& source);
+   template <class TypeBuiltArgument, typename TypeImplementationArgument>
+   TCompareHostFloatInterval& operator=(const TCompareHostFloatInterval<UMaxBitsNumber, TypeBaseFloatInterval, TypeBuiltArgument, TypeImplementationArgument>& source)
+      {  return operator=(thisType(source)); }
+
+   void setToMin() { dMax = dMin; }
+   void setToMax() { dMin = dMax; }
+   bool operator<(const thisType& source) const;
+   bool operator<=(const thisType& source) const;
+   bool operator==(const thisType& source) const;
+   bool operator!=(const thisType& source) const;
+   bool operator>=(const thisType& source) const;
+   bool operator>(const thisType& source) const;
+
+   thisType& operator+=(const thisType& source);
+   thisType& operator-=(const thisType& source);
+   thisType& operator*=(const thisType& source);
+   thisType& operator/=(const thisType& source);
+
+   void oppositeAssign()
+      {
+#ifdef FLOAT_CONCRETE
+         dValue = -dValue;
+#endif
+         TypeImplementation min = dMin;
+         dMin = -dMax;
+         dMax = -min;
+         inherited::notifyForCompare(*this);
+      }
+
+   typedef TypeImplementation ImplementationType;
+#ifdef FLOAT_CONCRETE
+   TypeImplementation asImplementation() const { return dValue; }
+#endif
+   void retrieveImplementationBounds(TypeImplementation& min, TypeImplementation& max) const
+      {  min = dMin; max = dMax; }
+   typedef Numerics::DDouble::Access::ReadParameters ReadParametersBase;
+   int64_t asLongInt(ReadParametersBase::RoundMode roundMode=ReadParametersBase::RMZero) const;
+   uint64_t asUnsignedLong(ReadParametersBase::RoundMode roundMode=ReadParametersBase::RMLowest) const;
+   int asInt(ReadParametersBase::RoundMode roundMode=ReadParametersBase::RMZero) const
+      {  return asLongInt(roundMode); }
+   unsigned asUnsigned(ReadParametersBase::RoundMode roundMode=ReadParametersBase::RMLowest) const
+      {  return asUnsignedLong(roundMode); }
+
+   void sqrtAssign();
+   void sinAssign();
+   void cosAssign();
+   void asinAssign();
+   void acosAssign();
+   void tanAssign();
+   void atanAssign();
+   void expAssign();
+   void logAssign();
+   void log10Assign();
+   void powAssign(const thisType& value);
+   void absAssign()
+      {  if (dMin < 0) {
+            if (dMax > 0) {
+               if (-dMin > dMax)
+                  dMax = -dMin;
+               dMin = 0;
+            }
+            else {
+               TypeImplementation min = dMin;
+               dMin = -dMax;
+               dMax = -min;
+            };
+         };
+#ifdef FLOAT_CONCRETE
+         if (dValue < 0)
+            dValue = -dValue;
+#endif
+         inherited::notifyForCompare(*this);
+      }
+};
+
+// same criterion as TCompareFloatInterval::adjustMin/adjustMax: a bound whose lower half
+//   of mantissa is not null likely comes from an approximated decimal constant
+template <int UMaxBitsNumber, class TypeBaseFloatInterval, class TypeBuiltDouble, typename TypeImplementation>
+inline bool
+TCompareHostFloatInterval<UMaxBitsNumber, TypeBaseFloatInterval, TypeBuiltDouble, TypeImplementation>::isApproximate(
+      TypeImplementation value) {
+   if (value < 0)
+      value = -value;
+   if (!(value > 0) || value > std::numeric_limits<TypeImplementation>::max())
+      return false;
+   // TypeBuiltDouble has one more bit of mantissa, always null after a native bound
+   int shiftCount = TypeBuiltDouble::BitSizeMantissa/2;
+   int approximateBits = ((shiftCount < (int) (8*sizeof(uint32_t))) ? shiftCount : (int) (8*sizeof(uint32_t))) - 1;
+   TypeImplementation ulp = (value >= std::numeric_limits<TypeImplementation>::min())
+      ? std::ldexp((TypeImplementation) 1, std::ilogb(value) - (std::numeric_limits<TypeImplementation>::digits-1))
+      : std::numeric_limits<TypeImplementation>::denorm_min();
+   return std::fmod(value, std::ldexp(ulp, approximateBits)) != 0;
+}
+
+template <int UMaxBitsNumber, class TypeBaseFloatInterval, class TypeBuiltDouble, typename TypeImplementation>
+template <class TypeBuiltArgument, typename TypeImplementationArgument>
+inline
+TCompareHostFloatInterval<UMaxBitsNumber, TypeBaseFloatInterval, TypeBuiltDouble, TypeImplementation>::TCompareHostFloatInterval(
+      const TCompareHostFloatInterval<UMaxBitsNumber, TypeBaseFloatInterval, TypeBuiltArgument, TypeImplementationArgument>& source)
+#ifdef FLOAT_CONCRETE
+   :  dValue((TypeImplementation) source.dValue), dMin((TypeImplementation) source.dMin), dMax((TypeImplementation) source.dMax)
+#else
+   :  dMin((TypeImplementation) source.dMin), dMax((TypeImplementation) source.dMax)
+#endif
+{  // the comparisons are done in the widest format, hence without rounding
+   if (dMin > source.dMin)
+      dMin = previous(dMin);
+   if (dMax < source.dMax)
+      dMax = next(dMax);
+   inherited::notifyForCompare(*this);
+}
+
+}} // end of namespace NumericalDomains::DDoubleInterval
@@ -31,10 +31,16 @@
 
 #include "StandardClasses/Persistence.h"
 #include "Pointer/SharedCollection.h"
+#include "Pointer/NodePool.h"
 #include "Collection/ConcreteCollection/List.h"
 #include "Collection/ConcreteCollection/Array.h"
 #include "Collection/ConcreteCollection/SortedArray.h"
 
+// defined by fldlib_config.h when every thread owns its analysis state
+#ifndef FLOAT_THREAD_LOCAL
+#define FLOAT_THREAD_LOCAL
+#endif
+
 namespace NumericalDomains { namespace DAffine {
 
 class SymbolsManager;
@@ -92,6 +98,7 @@ class Symbol : public SymbolRegistration, public PNT::SharedCollection::Element,
          return *this;
       }
    DefineCopy(Symbol)
+   DefineNodePoolAllocation
    DDefineAssign(Symbol)
    DCompare(Symbol)
    StaticInheritConversions(Symbol, inherited)
@@ -100,11 +107,32 @@ class Symbol : public SymbolRegistration, public PNT::SharedCollection::Element,
    void setOrder(int order) { uOrder = order; }
    int getOrder() const { return uOrder; }
    Type getType() const { return (Type) queryOwnField(); }
+   // integer key with the same order as compare: type, then level for closed symbols, then order
+   typedef uint64_t SortKey;
+   SortKey getSortKey() const;
    typedef HandlerIntermediateCast<Symbol, SymbolRegistration, COL::List::Node> Registration;
    virtual const char* getOwnPrefix() const { return "x_"; }
 
    void unlock(PNT::DSharedCollection::GlobalElement& call)  { PNT::SharedCollection::Element::unlock(call); }
    void lock(PNT::DSharedCollection::GlobalElement& call)    { PNT::SharedCollection::Element::lock(call); }
+
+   // visits the coefficients of the equations that refer to the symbol
+   template <class TypeFunction>
+   void foreachReference(TypeFunction function) const
+      {  if (!calls().isEmpty()) {
+            PNT::DSharedCollection::GlobalElement *call = calls().getFirst(), *last = calls().getLast();
+            function((const PNT::DSharedCollection::GlobalElement&) *call);
+            while (call != last) {
+               call = calls().getNext(call);
+               function((const PNT::DSharedCollection::GlobalElement&) *call);
+            };
+         };
+      }
+   int countReferences() const
+      {  int result = 0;
+         foreachReference([&result](const PNT::DSharedCollection::GlobalElement&) { ++result; });
+         return result;
+      }
 };
 
 class SymbolsManager;
@@ -342,20 +370,198 @@ class VirtualSymbolDefinitionTracker : public EnhancedObject {
 class SymbolsManager : public EnhancedObject {
   private:
    typedef EnhancedObject inherited;
-   COL::TCopyCollection<COL::TList<Symbol, Symbol::Registration> > lsCentralSymbols;
-   COL::TCopyCollection<COL::TList<Symbol, Symbol::Registration> > lsNoiseSymbols;
-   COL::TCopyCollection<COL::TList<Symbol, Symbol::Registration> > lsDefinedSymbols;
-   COL::TCopyCollection<COL::TList<Symbol, Symbol::Registration> > lsHighLevelSymbols;
+   typedef COL::TCopyCollection<COL::TList<Symbol, Symbol::Registration> > SymbolsList;
+
+   class SymbolsIndex {
+     private:
+      COL::TVector<Symbol*> vpsSymbols; // vpsSymbols[order-1-uBase] is the last symbol of the list with this order
+      int uBase = 0; // the orders up to uBase have no symbol, they are not stored in vpsSymbols
+      int uShadowed = 0; // number of symbols of the list hidden by a more recent symbol with the same order
+      int uHoles = 0; // number of null entries of vpsSymbols
+      static const int UMinTrimmedHoles = 64;
+
+      // only the inline methods of TVector are available in the units of the analyzed program
+      void trimFirstHoles()
+         {  int holes = 0;
+            while (holes < vpsSymbols.count() && !vpsSymbols[holes])
+               ++holes;
+            if (holes > 0) {
+               for (int index = holes; index < vpsSymbols.count(); ++index)
+                  vpsSymbols.referenceAt(index-holes) = vpsSymbols[index];
+               for (int index = 0; index < holes; ++index)
+                  vpsSymbols.removeAtEnd();
+               uBase += holes;
+               uHoles -= holes;
+            };
+         }
+      void rebase(int base)
+         {  int shift = uBase - base;
+            int count = vpsSymbols.count();
+            vpsSymbols.bookPlace(shift);
+            for (int index = 0; index < shift; ++index)
+               vpsSymbols.insertAtEnd(nullptr);
+            for (int index = count-1; index >= 0; --index)
+               vpsSymbols.referenceAt(index+shift) = vpsSymbols[index];
+            for (int index = 0; index < shift && index < count; ++index)
+               vpsSymbols.referenceAt(index) = nullptr;
+            uHoles += shift;
+            uBase = base;
+         }
+
+     public:
+      SymbolsIndex() = default;
+      SymbolsIndex(const SymbolsIndex&) = delete;
+
+      void swap(SymbolsIndex& source)
+         {  vpsSymbols.swap(source.vpsSymbols);
+            int temp = uBase;
+            uBase = source.uBase;
+            source.uBase = temp;
+            temp = uShadowed;
+            uShadowed = source.uShadowed;
+            source.uShadowed = temp;
+            temp = uHoles;
+            uHoles = source.uHoles;
+            source.uHoles = temp;
+         }
+      void clear() { vpsSymbols.removeAll(); uBase = 0; uShadowed = 0; uHoles = 0; }
+      void add(Symbol* symbol)
+         {  int order = symbol->getOrder();
+            if (order <= 0)
+               return;
+            if (order <= uBase) { // a reclaimed order is restored
+               if (vpsSymbols.count() > 0)
+                  rebase(0);
+               else
+                  uBase = order-1;
+            };
+            int position = order-1-uBase;
+            if (position >= vpsSymbols.count()) {
+               int added = position+1 - vpsSymbols.count();
+               vpsSymbols.bookPlace(added);
+               while (vpsSymbols.count() <= position)
+                  vpsSymbols.insertAtEnd(nullptr);
+               uHoles += added;
+            }
+            Symbol*& place = vpsSymbols.referenceAt(position);
+            if (place)
+               ++uShadowed;
+            else
+               --uHoles;
+            place = symbol;
+         }
+      void addAll(const SymbolsList& symbols)
+         {  COL::TList<Symbol, Symbol::Registration>::Cursor cursor(symbols);
+            while (cursor.setToNext())
+               add(&cursor.elementSAt());
+         }
+      // rebuilds the index after a bulk removal in symbols
+      void reset(const SymbolsList& symbols)
+         {  clear();
+            int minOrder = 0;
+            COL::TList<Symbol, Symbol::Registration>::Cursor cursor(symbols);
+            while (cursor.setToNext()) {
+               int order = cursor.elementAt().getOrder();
+               if (order > 0 && (minOrder == 0 || order < minOrder))
+                  minOrder = order;
+            };
+            if (minOrder > 0)
+               uBase = minOrder-1;
+            addAll(symbols);
+         }
+      // to call before the removal of symbol from symbols
+      void remove(Symbol* symbol, const SymbolsList& symbols)
+         {  int order = symbol->getOrder();
+            int position = order-1-uBase;
+            if (order <= 0 || position < 0 || position >= vpsSymbols.count())
+               return;
+            Symbol*& place = vpsSymbols.referenceAt(position);
+            if (place != symbol) {
+               if (place)
+                  --uShadowed;
+               return;
+            };
+            place = nullptr;
+            if (uShadowed > 0) {
+               COL::TList<Symbol, Symbol::Registration>::Cursor cursor(symbols);
+               while (cursor.setToPrevious()) {
+                  Symbol* previous = &cursor.elementSAt();
+                  if (previous != symbol && previous->getOrder() == order) {
+                     place = previous;
+                     --uShadowed;
+                     break;
+                  };
+               };
+            };
+            if (!place)
+               ++uHoles;
+            while (vpsSymbols.count() > 0 && !vpsSymbols.last()) {
+               vpsSymbols.removeAtEnd();
+               --uHoles;
+            };
+            if (uHoles > UMinTrimmedHoles && 2*uHoles > vpsSymbols.count())
+               trimFirstHoles();
+         }
+      Symbol* locate(int order) const
+         {  int position = order-1-uBase;
+            return (position >= 0 && position < vpsSymbols.count()) ? vpsSymbols[position] : nullptr;
+         }
+   };
+
+   SymbolsList lsCentralSymbols;
+   SymbolsList lsNoiseSymbols;
+   SymbolsList lsDefinedSymbols;
+   SymbolsList lsHighLevelSymbols;
+   SymbolsIndex siCentralSymbols;
+   SymbolsIndex siNoiseSymbols;
+   SymbolsIndex siDefinedSymbols;
+   SymbolsIndex siHighLevelSymbols;
    int uHighLevelSymbolsCounter = 0;
+   int uNoiseSymbolsCounter = 0; // last order given to a noise symbol, the orders stay increasing after a collection
    bool fPermanent = false;
 
+   // reclamation of the noise symbols that no coefficient refers to any more
+   bool fCollectNoiseSymbols = false;
+   bool fCompactNoiseSymbols = false;
+   int uCollectionThreshold = UMinCollectionThreshold; // number of held noise symbols that triggers the next collection
+   int uCreatedNoiseSymbols = 0;
+   int uPeakNoiseSymbols = 0;
+   static const int UMinCollectionThreshold = 1024;
+
+   // global budget on the footprint of the noise symbols, that is the number of coefficients
+   // of the equations on noise symbols. The condensation is left to the domain (TSimplificationRules)
+   int uNoiseSymbolsBudget = 0;
+   int uNextFootprintCheck = 0; // value of uCreatedNoiseSymbols that triggers the next evaluation of the footprint
+   int uFootprintCondensations = 0;
+   static const int UMinFootprintCheckPeriod = 64;
+
+   void notifyNoiseSymbolCreation()
+      {  ++uCreatedNoiseSymbols;
+         if (lsNoiseSymbols.count() > uPeakNoiseSymbols)
+            uPeakNoiseSymbols = lsNoiseSymbols.count();
+      }
+   void compactNoiseSymbolOrders();
+
+   void freeLastSymbol(SymbolsList& symbols, SymbolsIndex& index)
+      {  index.remove(&symbols.getSLast(), symbols);
+         symbols.freeLast();
+      }
+   void freeSymbolIn(Symbol* symbol, SymbolsList& symbols, SymbolsIndex& index)
+      {  index.remove(symbol, symbols);
+         COL::TList<Symbol, Symbol::Registration>::Cursor cursor(symbols);
+         cursor.gotoReference(*symbol);
+         symbols.freeAt(cursor);
+      }
+
   protected:
    void setPermanent() { fPermanent = true; }
 
   public:
    SymbolsManager() = default;
    SymbolsManager(const SymbolsManager& source)
-      : EnhancedObject(source), uHighLevelSymbolsCounter(0), fPermanent(source.fPermanent) {}
+      :  EnhancedObject(source), uHighLevelSymbolsCounter(0), fPermanent(source.fPermanent),
+         fCollectNoiseSymbols(source.fCollectNoiseSymbols), fCompactNoiseSymbols(source.fCompactNoiseSymbols),
+         uNoiseSymbolsBudget(source.uNoiseSymbolsBudget) {}
    DefineCopy(SymbolsManager)
 
    virtual VirtualSymbolDefinitionTracker* getSymbolDefinitionTracker() { return nullptr; }
@@ -365,22 +571,50 @@ class SymbolsManager : public EnhancedObject {
          lsNoiseSymbols.swap(source.lsNoiseSymbols);
          lsDefinedSymbols.swap(source.lsDefinedSymbols);
          lsHighLevelSymbols.swap(source.lsHighLevelSymbols);
+         siCentralSymbols.swap(source.siCentralSymbols);
+         siNoiseSymbols.swap(source.siNoiseSymbols);
+         siDefinedSymbols.swap(source.siDefinedSymbols);
+         siHighLevelSymbols.swap(source.siHighLevelSymbols);
          int temp = uHighLevelSymbolsCounter;
          uHighLevelSymbolsCounter = source.uHighLevelSymbolsCounter;
          source.uHighLevelSymbolsCounter = temp;
+         temp = uNoiseSymbolsCounter;
+         uNoiseSymbolsCounter = source.uNoiseSymbolsCounter;
+         source.uNoiseSymbolsCounter = temp;
+         temp = uCollectionThreshold;
+         uCollectionThreshold = source.uCollectionThreshold;
+         source.uCollectionThreshold = temp;
+         temp = uCreatedNoiseSymbols;
+         uCreatedNoiseSymbols = source.uCreatedNoiseSymbols;
+         source.uCreatedNoiseSymbols = temp;
+         temp = uPeakNoiseSymbols;
+         uPeakNoiseSymbols = source.uPeakNoiseSymbols;
+         source.uPeakNoiseSymbols = temp;
+         temp = uNextFootprintCheck;
+         uNextFootprintCheck = source.uNextFootprintCheck;
+         source.uNextFootprintCheck = temp;
+         temp = uFootprintCondensations;
+         uFootprintCondensations = source.uFootprintCondensations;
+         source.uFootprintCondensations = temp;
       }
    void clear()
       {  lsCentralSymbols.freeAll();
          lsNoiseSymbols.freeAll();
          lsDefinedSymbols.freeAll();
          lsHighLevelSymbols.freeAll();
+         siCentralSymbols.clear();
+         siNoiseSymbols.clear();
+         siDefinedSymbols.clear();
+         siHighLevelSymbols.clear();
          uHighLevelSymbolsCounter = 0;
+         uNoiseSymbolsCounter = 0;
+         uCollectionThreshold = UMinCollectionThreshold;
       }
    bool contains(const Symbol& symbol) const
       {  switch (symbol.getType()) {
             case Symbol::TCentral: return symbol.getOrder() <= lsCentralSymbols.count();
-            case Symbol::TNoise: return symbol.getOrder() <= lsNoiseSymbols.count();
-            case Symbol::TMarkedNoise: return symbol.getOrder() <= lsNoiseSymbols.count();
+            case Symbol::TNoise: return symbol.getOrder() <= uNoiseSymbolsCounter;
+            case Symbol::TMarkedNoise: return symbol.getOrder() <= uNoiseSymbolsCounter;
             case Symbol::TClosed: return false;
             case Symbol::TDefined: return symbol.getOrder() <= lsDefinedSymbols.count();
             case Symbol::THighLevel: return symbol.getOrder() <= uHighLevelSymbolsCounter;
@@ -405,19 +639,19 @@ class SymbolsManager : public EnhancedObject {
       MergeTable() = default;
       MergeTable(const SymbolsManager& symbolsManager)
          :  uCentralSymbolsLimit(symbolsManager.lsCentralSymbols.count()),
-            uNoiseSymbolsLimit(symbolsManager.lsNoiseSymbols.count()),
+            uNoiseSymbolsLimit(symbolsManager.uNoiseSymbolsCounter),
             uDefinedSymbolsLimit(symbolsManager.lsDefinedSymbols.count()),
             uHighLevelSymbolsLimit(symbolsManager.uHighLevelSymbolsCounter) {}
 
       void setInitial(const SymbolsManager& symbolsManager)
          {  uCentralSymbolsLimit = symbolsManager.lsCentralSymbols.count();
-            uNoiseSymbolsLimit = symbolsManager.lsNoiseSymbols.count();
+            uNoiseSymbolsLimit = symbolsManager.uNoiseSymbolsCounter;
             uDefinedSymbolsLimit = symbolsManager.lsDefinedSymbols.count();
             uHighLevelSymbolsLimit = symbolsManager.uHighLevelSymbolsCounter;
          }
       void setAfterMerge(const SymbolsManager& symbolsManager)
          {  uCentralSymbolsAfterMerge = symbolsManager.lsCentralSymbols.count();
-            uNoiseSymbolsAfterMerge = symbolsManager.lsNoiseSymbols.count();
+            uNoiseSymbolsAfterMerge = symbolsManager.uNoiseSymbolsCounter;
             uDefinedSymbolsAfterMerge = symbolsManager.lsDefinedSymbols.count();
             uHighLevelSymbolsAfterMerge = symbolsManager.uHighLevelSymbolsCounter;
          }
@@ -432,11 +666,11 @@ class SymbolsManager : public EnhancedObject {
          }
       Symbol& findNoiseSymbol(int index, SymbolsManager& symbolsManager) const
          {  if (index <= uNoiseSymbolsLimit)
-               return symbolsManager.findNoiseSymbol(index);
+               return symbolsManager.restoreNoiseSymbol(index);
             index += uNoiseSymbolsAfterMerge-uNoiseSymbolsLimit;
-            while (symbolsManager.lsNoiseSymbols.count() < index)
+            while (symbolsManager.uNoiseSymbolsCounter < index)
                symbolsManager.createNoiseSymbol();
-            return symbolsManager.findNoiseSymbol(index);
+            return symbolsManager.restoreNoiseSymbol(index);
          }
       template <class TypeTraits>
       Symbol& findDefinedSymbol(TypeTraits traits, int index, SymbolsManager& symbolsManager,
@@ -475,18 +709,24 @@ class SymbolsManager : public EnhancedObject {
       {  Symbol* result = new CentralSymbol();
          lsCentralSymbols.insertNewAtEnd(result);
          result->setOrder(lsCentralSymbols.count());
+         siCentralSymbols.add(result);
          return result;
       }
    virtual Symbol* createNoiseSymbol()
-      {  Symbol* result = new NoiseSymbol();
+      {  if (fCollectNoiseSymbols && lsNoiseSymbols.count() >= uCollectionThreshold)
+            collectNoiseSymbols();
+         Symbol* result = new NoiseSymbol();
          lsNoiseSymbols.insertNewAtEnd(result);
-         result->setOrder(lsNoiseSymbols.count());
+         result->setOrder(++uNoiseSymbolsCounter);
+         siNoiseSymbols.add(result);
+         notifyNoiseSymbolCreation();
          return result;
       }
    virtual Symbol* createHighLevelSymbol()
       {  Symbol* result = new HighLevelSymbol();
          lsHighLevelSymbols.insertNewAtEnd(result);
          result->setOrder(++uHighLevelSymbolsCounter);
+         siHighLevelSymbols.add(result);
          return result;
       }
    void freeHighLevelSymbol(HighLevelSymbol* symbol) // [TODO] verify the manager for LinearInvariantSynthesis!!!
@@ -496,9 +736,7 @@ class SymbolsManager : public EnhancedObject {
          AssumeCondition(!lsHighLevelSymbols.foreachDo([symbol](const Symbol& iterate)
             {  return &iterate != symbol; }))
 #endif
-         COL::TList<Symbol, Symbol::Registration>::Cursor cursor(lsHighLevelSymbols);
-         cursor.gotoReference(*symbol);
-         lsHighLevelSymbols.freeAt(cursor);
+         freeSymbolIn(symbol, lsHighLevelSymbols, siHighLevelSymbols);
       }
    void freeSymbol(Symbol* symbol, bool hasShift=false)
       {  if (fPermanent)
@@ -510,21 +748,17 @@ class SymbolsManager : public EnhancedObject {
                   AssumeCondition(!lsCentralSymbols.foreachDo([symbol](const Symbol& iterate)
                      {  return &iterate != symbol; }))
 #endif
-                  COL::TList<Symbol, Symbol::Registration>::Cursor cursor(lsCentralSymbols);
-                  cursor.gotoReference(*symbol);
-                  lsCentralSymbols.freeAt(cursor);
+                  freeSymbolIn(symbol, lsCentralSymbols, siCentralSymbols);
                }
                break;
             case Symbol::TNoise:
             case Symbol::TMarkedNoise:
-               {  AssumeCondition(hasShift || symbol->getOrder() <= lsNoiseSymbols.count())
+               {  AssumeCondition(hasShift || symbol->getOrder() <= uNoiseSymbolsCounter)
 #if DefineDebugLevel >= 3
                   AssumeCondition(!lsNoiseSymbols.foreachDo([symbol](const Symbol& iterate)
                      {  return &iterate != symbol; }))
 #endif
-                  COL::TList<Symbol, Symbol::Registration>::Cursor cursor(lsNoiseSymbols);
-                  cursor.gotoReference(*symbol);
-                  lsNoiseSymbols.freeAt(cursor);
+                  freeSymbolIn(symbol, lsNoiseSymbols, siNoiseSymbols);
                }
                break;
             case Symbol::TClosed:
@@ -535,9 +769,7 @@ class SymbolsManager : public EnhancedObject {
                   AssumeCondition(!lsDefinedSymbols.foreachDo([symbol](const Symbol& iterate)
                      {  return &iterate != symbol; }))
 #endif
-                  COL::TList<Symbol, Symbol::Registration>::Cursor cursor(lsDefinedSymbols);
-                  cursor.gotoReference(*symbol);
-                  lsDefinedSymbols.freeAt(cursor);
+                  freeSymbolIn(symbol, lsDefinedSymbols, siDefinedSymbols);
                }
                break;
             case Symbol::THighLevel:
@@ -546,9 +778,7 @@ class SymbolsManager : public EnhancedObject {
                   AssumeCondition(!lsHighLevelSymbols.foreachDo([symbol](const Symbol& iterate)
                      {  return &iterate != symbol; }))
 #endif
-                  COL::TList<Symbol, Symbol::Registration>::Cursor cursor(lsHighLevelSymbols);
-                  cursor.gotoReference(*symbol);
-                  lsHighLevelSymbols.freeAt(cursor);
+                  freeSymbolIn(symbol, lsHighLevelSymbols, siHighLevelSymbols);
                }
                break;
             case Symbol::TConstrained:
@@ -563,6 +793,7 @@ class SymbolsManager : public EnhancedObject {
       {  Symbol* result = new typename TypeTraits::DefinedSymbol(definition);
          lsDefinedSymbols.insertNewAtEnd(result);
          result->setOrder(lsDefinedSymbols.count());
+         siDefinedSymbols.add(result);
          return result;
       }
    template <class TypeTraits>
@@ -580,79 +811,147 @@ class SymbolsManager : public EnhancedObject {
                && !symbol->hasOrder())
          lsDefinedSymbols.insertNewAtEnd(symbol);
          symbol->setOrder(lsDefinedSymbols.count());
+         siDefinedSymbols.add(symbol);
          return *symbol;
       }
    Symbol* createMarkedNoiseSymbol(int order)
       {  Symbol* result = new MarkedNoiseSymbol(order);
          lsNoiseSymbols.insertNewAtEnd(result);
+         ++uNoiseSymbolsCounter; // a marked symbol takes a place in the orders
+         siNoiseSymbols.add(result);
+         notifyNoiseSymbolCreation();
          return result;
       }
-#if defined(__clang__)
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wempty-body"
-#endif
    Symbol& findDefinedSymbol(int index) const
-      {  COL::TList<Symbol, Symbol::Registration>::Cursor cursor(lsDefinedSymbols);
-         Symbol* result = nullptr;
-         while (cursor.setToPrevious() && (result = &cursor.elementSAt())->getOrder() > index) {}
-         AssumeCondition(cursor.isValid() && result->getOrder() == index)
+      {  Symbol* result = siDefinedSymbols.locate(index);
+         AssumeCondition(result)
          return *result;
       }
    Symbol& findCentralSymbol(int index) const
-      {  COL::TList<Symbol, Symbol::Registration>::Cursor cursor(lsCentralSymbols);
-         Symbol* result = nullptr;
-         while (cursor.setToPrevious() && (result = &cursor.elementSAt())->getOrder() > index) {}
-         AssumeCondition(cursor.isValid() && result->getOrder() == index)
+      {  Symbol* result = siCentralSymbols.locate(index);
+         AssumeCondition(result)
          return *result;
       }
    Symbol& findNoiseSymbol(int index) const
-      {  COL::TList<Symbol, Symbol::Registration>::Cursor cursor(lsNoiseSymbols);
-         Symbol* result = nullptr;
-         while (cursor.setToPrevious() && (result = &cursor.elementSAt())->getOrder() > index) {}
-         AssumeCondition(cursor.isValid() && result->getOrder() == index)
+      {  Symbol* result = siNoiseSymbols.locate(index);
+         AssumeCondition(result)
+         return *result;
+      }
+   // findNoiseSymbol for an order that may have been reclaimed since the symbol was written
+   // a reclaimed symbol had no coefficient, so a new symbol with the same order replaces it
+   Symbol& restoreNoiseSymbol(int index)
+      {  Symbol* result = siNoiseSymbols.locate(index);
+         if (!result) {
+            AssumeCondition(fCollectNoiseSymbols && index > 0 && index <= uNoiseSymbolsCounter)
+            result = new NoiseSymbol();
+            lsNoiseSymbols.insertNewAtEnd(result);
+            result->setOrder(index);
+            siNoiseSymbols.add(result);
+            if (lsNoiseSymbols.count() > uPeakNoiseSymbols)
+               uPeakNoiseSymbols = lsNoiseSymbols.count();
+         };
          return *result;
       }
    Symbol& findHighLevelSymbol(int index) const
-      {  COL::TList<Symbol, Symbol::Registration>::Cursor cursor(lsHighLevelSymbols);
-         Symbol* result = nullptr;
-         while (cursor.setToPrevious() && (result = &cursor.elementSAt())->getOrder() > index) {}
-         AssumeCondition(cursor.isValid() && result->getOrder() == index)
+      {  Symbol* result = siHighLevelSymbols.locate(index);
+         AssumeCondition(result)
          return *result;
       }
    Symbol* locateHighLevelSymbol(int index) const
-      {  COL::TList<Symbol, Symbol::Registration>::Cursor cursor(lsHighLevelSymbols);
-         Symbol* result = nullptr;
-         while (cursor.setToPrevious() && (result = &cursor.elementSAt())->getOrder() > index) {}
-         return (result && result->getOrder() == index) ? result : nullptr;
-      }
+      {  return siHighLevelSymbols.locate(index); }
    Symbol* locateSymbol(const Symbol::Type type, int index) const
-      {  const COL::TCopyCollection<COL::TList<Symbol, Symbol::Registration> >* listSymbols = nullptr;
-         switch (type) {
-            case Symbol::TCentral: listSymbols = &lsCentralSymbols; break;
-            case Symbol::TNoise: listSymbols = &lsNoiseSymbols; break;
-            case Symbol::TMarkedNoise: listSymbols = &lsNoiseSymbols; break;
-            case Symbol::TDefined: listSymbols = &lsDefinedSymbols; break;
-            case Symbol::THighLevel:  listSymbols = &lsHighLevelSymbols; break;
+      {  switch (type) {
+            case Symbol::TCentral: return siCentralSymbols.locate(index);
+            case Symbol::TNoise: return siNoiseSymbols.locate(index);
+            case Symbol::TMarkedNoise: return siNoiseSymbols.locate(index);
+            case Symbol::TDefined: return siDefinedSymbols.locate(index);
+            case Symbol::THighLevel: return siHighLevelSymbols.locate(index);
             default:
                return nullptr;
          }
-         COL::TList<Symbol, Symbol::Registration>::Cursor cursor(*listSymbols);
-         Symbol* result = nullptr;
-         while (cursor.setToPrevious() && (result = &cursor.elementSAt())->getOrder() > index) {}
-         return (result && result->getOrder() == index) ? result : nullptr;
       }
 
-#if defined(__clang__)
-#pragma GCC diagnostic pop
-#endif
-
    int getCountCentralSymbols() const { return lsCentralSymbols.count(); }
    int getCountNoiseSymbols() const { return lsNoiseSymbols.count(); }
+   int getMaxNoiseSymbolOrder() const { return uNoiseSymbolsCounter; }
+   int getCreatedNoiseSymbols() const { return uCreatedNoiseSymbols; }
+   int getPeakNoiseSymbols() const { return uPeakNoiseSymbols; }
+
+   // the noise symbols without any coefficient are freed every time the number of held noise
+   // symbols doubles since the last collection. A collection happens within createNoiseSymbol,
+   // hence the caller should not keep a noise symbol out of any equation while it creates another one.
+   void setCollectNoiseSymbols(bool value=true) { fCollectNoiseSymbols = value; }
+   bool doesCollectNoiseSymbols() const { return fCollectNoiseSymbols; }
+   // the collection renumbers the remaining noise symbols from 1 (with the same relative order).
+   // Only valid when no merge table and no written equation refers to the previous orders.
+   void setCompactNoiseSymbols(bool value=true) { fCompactNoiseSymbols = value; }
+   int collectNoiseSymbols()
+      {  int result = 0;
+         if (!fPermanent) {
+            COL::TList<Symbol, Symbol::Registration>::Cursor cursor(lsNoiseSymbols);
+            while (cursor.setToNext()) {
+               const Symbol& symbol = cursor.elementAt();
+               if (symbol.getType() == Symbol::TNoise && !symbol.isReferenced()) {
+                  COL::TList<Symbol, Symbol::Registration>::Cursor removeCursor(cursor);
+                  cursor.setToPrevious();
+                  lsNoiseSymbols.freeAt(removeCursor);
+                  ++result;
+               };
+            };
+            if (result > 0) {
+               if (fCompactNoiseSymbols)
+                  compactNoiseSymbolOrders();
+               siNoiseSymbols.reset(lsNoiseSymbols);
+            };
+         };
+         uCollectionThreshold = 2*lsNoiseSymbols.count();
+         if (uCollectionThreshold < UMinCollectionThreshold)
+            uCollectionThreshold = UMinCollectionThreshold;
+         return result;
+      }
+
+   // the domain condenses the least significant noise symbols when the footprint exceeds the budget.
+   // The footprint is evaluated every budget/16 created noise symbols.
+   void setNoiseSymbolsBudget(int budget)
+      {  uNoiseSymbolsBudget = budget;
+         uNextFootprintCheck = uCreatedNoiseSymbols;
+      }
+   bool hasNoiseSymbolsBudget() const { return uNoiseSymbolsBudget > 0; }
+   int getNoiseSymbolsBudget() const { return uNoiseSymbolsBudget; }
+   bool isFootprintToCheck() const
+      {  return uNoiseSymbolsBudget > 0 && uCreatedNoiseSymbols >= uNextFootprintCheck; }
+   int computeNoiseSymbolsFootprint()
+      {  int result = 0;
+         COL::TList<Symbol, Symbol::Registration>::Cursor cursor(lsNoiseSymbols);
+         while (cursor.setToNext())
+            result += cursor.elementAt().countReferences();
+         int period = uNoiseSymbolsBudget/16;
+         if (period < UMinFootprintCheckPeriod)
+            period = UMinFootprintCheckPeriod;
+         uNextFootprintCheck = uCreatedNoiseSymbols + period;
+         return result;
+      }
+   void notifyFootprintCondensation() { ++uFootprintCondensations; }
+   int getFootprintCondensations() const { return uFootprintCondensations; }
+   template <class TypeFunction>
+   void foreachNoiseSymbol(TypeFunction function) const
+      {  COL::TList<Symbol, Symbol::Registration>::Cursor cursor(lsNoiseSymbols);
+         while (cursor.setToNext())
+            function(cursor.elementAt());
+      }
    int getCountDefinedSymbols() const { return lsDefinedSymbols.count(); }
    int getMaxHighLevelSymbolOrder() const { return uHighLevelSymbolsCounter; }
 
    void moveCountedSymbolsTo(SymbolsManager& receiver)
-      {  lsCentralSymbols.moveAllTo(receiver.lsCentralSymbols);
+      {  receiver.uNoiseSymbolsCounter += lsNoiseSymbols.count();
+         uNoiseSymbolsCounter = 0;
+         receiver.siCentralSymbols.addAll(lsCentralSymbols);
+         receiver.siNoiseSymbols.addAll(lsNoiseSymbols);
+         receiver.siDefinedSymbols.addAll(lsDefinedSymbols);
+         siCentralSymbols.clear();
+         siNoiseSymbols.clear();
+         siDefinedSymbols.clear();
+         lsCentralSymbols.moveAllTo(receiver.lsCentralSymbols);
          lsNoiseSymbols.moveAllTo(receiver.lsNoiseSymbols);
          lsDefinedSymbols.moveAllTo(receiver.lsDefinedSymbols);
       }
@@ -660,6 +959,8 @@ class SymbolsManager : public EnhancedObject {
       {  COL::TList<Symbol, Symbol::Registration>::Cursor
             cursor(lsHighLevelSymbols), receiverCursor(receiver.lsHighLevelSymbols);
          cursor.gotoReference(symbol);
+         siHighLevelSymbols.remove(&symbol, lsHighLevelSymbols);
+         receiver.siHighLevelSymbols.add(&symbol);
          if (beforeReceiver) {
             AssumeCondition(beforeReceiver->getOrder() < symbol.getOrder())
             receiverCursor.gotoReference(*beforeReceiver);
@@ -670,19 +971,21 @@ class SymbolsManager : public EnhancedObject {
       }
    void freeCentralSymbolsAfter(int centralOrder)
       {  while (!lsCentralSymbols.isEmpty() && lsCentralSymbols.getLast().getOrder() > centralOrder)
-            lsCentralSymbols.freeLast();
+            freeLastSymbol(lsCentralSymbols, siCentralSymbols);
       }
    void freeNoiseSymbolsAfter(int noiseOrder)
       {  while (!lsNoiseSymbols.isEmpty() && lsNoiseSymbols.getLast().getOrder() > noiseOrder)
-            lsNoiseSymbols.freeLast();
+            freeLastSymbol(lsNoiseSymbols, siNoiseSymbols);
+         if (uNoiseSymbolsCounter > noiseOrder)
+            uNoiseSymbolsCounter = noiseOrder;
       }
    void freeDefinedSymbolsAfter(int definedOrder)
       {  while (!lsDefinedSymbols.isEmpty() && lsDefinedSymbols.getLast().getOrder() > definedOrder)
-            lsDefinedSymbols.freeLast();
+            freeLastSymbol(lsDefinedSymbols, siDefinedSymbols);
       }
    void freeHighLevelSymbolsAfter(int highLevelOrder)
       {  while (!lsHighLevelSymbols.isEmpty() && lsHighLevelSymbols.getLast().getOrder() > highLevelOrder)
-            lsHighLevelSymbols.freeLast();
+            freeLastSymbol(lsHighLevelSymbols, siHighLevelSymbols);
          uHighLevelSymbolsCounter = highLevelOrder;
       }
 };
@@ -706,6 +1009,40 @@ class ClosedSymbolsSet : public EnhancedObject {
       }
 };
 
+inline void
+SymbolsManager::compactNoiseSymbolOrders() {
+   // increasing renumbering: the coefficients of the equations remain sorted
+   COL::TVector<int> newOrders;
+   newOrders.bookPlace(uNoiseSymbolsCounter+1);
+   for (int order = 0; order <= uNoiseSymbolsCounter; ++order)
+      newOrders.insertAtEnd(0);
+   COL::TList<Symbol, Symbol::Registration>::Cursor cursor(lsNoiseSymbols);
+   while (cursor.setToNext())
+      newOrders.referenceAt(cursor.elementAt().getOrder()) = 1;
+   int lastOrder = 0;
+   for (int order = 1; order <= uNoiseSymbolsCounter; ++order) {
+      if (newOrders[order])
+         newOrders.referenceAt(order) = ++lastOrder;
+   };
+   COL::TList<Symbol, Symbol::Registration>::Cursor renumberCursor(lsNoiseSymbols);
+   while (renumberCursor.setToNext())
+      renumberCursor.elementSAt().setOrder(newOrders[renumberCursor.elementAt().getOrder()]);
+   uNoiseSymbolsCounter = lastOrder;
+}
+
+inline Symbol::SortKey
+Symbol::getSortKey() const {
+   AssumeCondition(uOrder >= 0)
+   SortKey result = ((SortKey) queryOwnField() << 60) | (SortKey) (unsigned) uOrder;
+   if (queryOwnField() == TClosed) {
+      AssumeCondition(dynamic_cast<const ClosedSymbol*>(this)
+            && ((const ClosedSymbol&) *this).getLevel() >= 0
+            && ((const ClosedSymbol&) *this).getLevel() < (1 << 28))
+      result |= (SortKey) ((const ClosedSymbol&) *this).getLevel() << 32;
+   };
+   return result;
+}
+
 inline ComparisonResult
 ClosedSymbol::_compare(const EnhancedObject& asource) const {
    const Symbol& source = (const Symbol&) Symbol::castFromCopyHandler(asource);
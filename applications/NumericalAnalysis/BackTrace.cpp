@@ -131,6 +131,125 @@ writeSimplifiedBackTrace(STG::IOObject::OSBase& out) { // code from unisim
    free(stack_strings);
 }
 
+int
+SimplifiedBackTraces::record() {
+   static const unsigned int max_depth = 32;
+
+   void* stack_addrs[max_depth+1];
+   int stack_depth = backtrace(stack_addrs, max_depth + 1);
+   // the level 0 is this method, like writeSimplifiedBackTrace in the eager version
+   if (stack_depth > 1)
+      vAddresses.insert(vAddresses.end(), stack_addrs+1, stack_addrs+stack_depth);
+   vTraceEnds.push_back((unsigned) vAddresses.size());
+   return (int) vTraceEnds.size()-1;
+}
+
+void
+SimplifiedBackTraces::symbolize() {
+   std::vector<void*> newAddresses;
+   for (; uSymbolizedEnd < vAddresses.size(); ++uSymbolizedEnd) {
+      void* address = vAddresses[uSymbolizedEnd];
+      if (mFrames.insert(std::make_pair(address, Frame())).second)
+         newAddresses.push_back(address);
+   };
+   if (newAddresses.empty())
+      return;
+
+   char **stack_strings = backtrace_symbols(newAddresses.data(), (int) newAddresses.size());
+   for (size_t index = 0; index < newAddresses.size(); ++index) {
+      Frame& frame = mFrames[newAddresses[index]];
+      char *begin_of_mangled_name = 0;
+      char *end_of_mangled_name = 0;
+      char *begin_of_address = 0;
+      char *end_of_address = 0;
+
+      // same parsing as writeSimplifiedBackTrace
+      char *pos = stack_strings[index];
+      while(*pos) {
+         if (*pos == '(') {
+            *pos = 0;
+            pos++;
+            begin_of_mangled_name = pos;
+            break;
+         }
+         pos++;
+      }
+
+      while(*pos) {
+         if (*pos == '+') {
+            *pos = 0;
+            end_of_mangled_name = pos++;
+            break;
+         }
+         else if (*pos == ')') {
+            *pos = 0;
+            begin_of_mangled_name = 0;
+            pos++;
+            break;
+         }
+         pos++;
+      }
+
+      while(*pos) {
+         if (*pos == '[') {
+            pos++;
+            begin_of_address = pos;
+            break;
+         }
+         pos++;
+      }
+
+      while(*pos) {
+         if (*pos == ']') {
+            *pos = 0;
+            end_of_address = pos;
+            break;
+         }
+         pos++;
+      }
+
+      if (begin_of_mangled_name && end_of_mangled_name > begin_of_mangled_name) {
+         size_t length = end_of_mangled_name-begin_of_mangled_name;
+         char *output = 0;
+         int status;
+         char *demangled_name = abi::__cxa_demangle(begin_of_mangled_name, output, &length, &status);
+         if (status == 0 && demangled_name)
+            frame.isInLibrary = strncmp(demangled_name, "NumericalDomains::", 18) == 0;
+         if (status != -1) free(output);
+         if (demangled_name) free(demangled_name);
+      }
+      if (!frame.isInLibrary && begin_of_address && end_of_address)
+         frame.address = begin_of_address;
+   };
+   free(stack_strings);
+}
+
+void
+SimplifiedBackTraces::write(STG::IOObject::OSBase& out, int trace) {
+   AssumeCondition(trace >= 0 && trace < (int) vTraceEnds.size())
+   if (uSymbolizedEnd < vAddresses.size())
+      symbolize();
+   unsigned start = (trace > 0) ? vTraceEnds[trace-1] : 0;
+   bool isFirst = true, isInLibrary = false;
+   for (unsigned index = start; index < vTraceEnds[trace]; ++index) {
+      const Frame& frame = mFrames.find(vAddresses[index])->second;
+      if (frame.isInLibrary) {
+         isInLibrary = true;
+         continue;
+      };
+      if (!frame.address.empty()) {
+         if (!isFirst)
+            out.writesome(", ");
+         out.put('[');
+         out.writesome(frame.address.c_str());
+         out.put(']');
+         isFirst = false;
+         if (isInLibrary)
+            break;
+      };
+   }
+}
+
 void
 writeBackTrace(STG::IOObject::OSBase& out) { // code from unisim
    static const unsigned int max_depth = 32;
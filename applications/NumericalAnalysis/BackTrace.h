@@ -30,10 +30,42 @@
 #pragma once
 
 #include "StandardClasses/Persistence.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace NumericalDomains {
 
 void writeSimplifiedBackTrace(STG::IOObject::OSBase& out);
+
+/* Records the return addresses of simplified backtraces in a compact buffer without
+   any symbolization. Each unique address is symbolized only once, when the traces
+   are written with the format of writeSimplifiedBackTrace. */
+class SimplifiedBackTraces {
+  private:
+   struct Frame {
+      bool isInLibrary = false;
+      std::string address;
+   };
+
+   std::vector<void*> vAddresses;
+   std::vector<unsigned> vTraceEnds;
+   std::unordered_map<void*, Frame> mFrames;
+   unsigned uSymbolizedEnd = 0;
+
+   void symbolize();
+
+  public:
+   SimplifiedBackTraces() = default;
+   SimplifiedBackTraces(const SimplifiedBackTraces& source) = default;
+
+   int record();
+   int count() const { return (int) vTraceEnds.size(); }
+   int countFrames() const { return (int) vAddresses.size(); }
+   int countSymbolizedFrames() const { return (int) mFrames.size(); }
+   void write(STG::IOObject::OSBase& out, int trace);
+   void clear() { vAddresses.clear(); vTraceEnds.clear(); uSymbolizedEnd = 0; }
+};
 void writeBackTrace(STG::IOObject::OSBase& out);
 void readBackTrace(STG::IOObject::ISBase& in);
 
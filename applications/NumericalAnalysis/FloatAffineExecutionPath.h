@@ -31,6 +31,12 @@
 #pragma once
 
 #include <cfloat>
+#if defined(FLOAT_AFFINE_SOUND_ACCELERATION)
+#include <cfenv>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#endif
 
 #if !defined(FLOAT_GENERIC_BASE_UNSIGNED) && !defined(FLOAT_GENERIC_BASE_LONG)
 #include "NumericalDomains/FloatAffineBase.h"
@@ -89,7 +95,7 @@ struct FloatDigitsHelper {
    class TFloatDigits : public DFloatDigitsHelper::TFloatDigits<TypeImplementation> {};
 };
 
-#if defined(FLOAT_AFFINE_ACCELERATION)
+#if defined(FLOAT_AFFINE_ACCELERATION) || defined(FLOAT_AFFINE_SOUND_ACCELERATION)
 
 #include "NumericalAnalysis/FloatAffineAcceleration.inch"
 
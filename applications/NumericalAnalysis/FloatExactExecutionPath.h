@@ -39,6 +39,11 @@
 #include "Numerics/Integer.h"
 #endif
 
+// defined by fldlib_config.h when every thread owns its analysis state
+#ifndef FLOAT_THREAD_LOCAL
+#define FLOAT_THREAD_LOCAL
+#endif
+
 namespace NumericalDomains {
 
 namespace DDoubleExact {
@@ -164,7 +169,7 @@ struct TFloatDigitsConnectionHelper<
 class BaseExecutionPath {
   protected:
    enum SpecialValue { SVNone, SVNoReal, SVNoImplementation, SVEnd };
-   static Numerics::DDouble::Access::ReadParameters rpNearestParams;
+   static FLOAT_THREAD_LOCAL Numerics::DDouble::Access::ReadParameters rpNearestParams;
 
   public:
    static void initializeNearestParams()
@@ -33,6 +33,14 @@
 #include <cfloat>
 
 #include "NumericalDomains/FloatIntervalBase.h"
+#ifdef FLOAT_NATIVE_INTERVAL
+#include "NumericalDomains/FloatIntervalHost.h"
+#endif
+
+// defined by fldlib_config.h when every thread owns its analysis state
+#ifndef FLOAT_THREAD_LOCAL
+#define FLOAT_THREAD_LOCAL
+#endif
 
 namespace NumericalDomains { namespace DDoubleInterval {
 
@@ -106,8 +114,8 @@ struct TFloatDigitsConnectionHelper<
 
 class BaseExecutionPath {
   protected:
-   static Numerics::DDouble::Access::ReadParameters rpMinParams;
-   static Numerics::DDouble::Access::ReadParameters rpMaxParams;
+   static FLOAT_THREAD_LOCAL Numerics::DDouble::Access::ReadParameters rpMinParams;
+   static FLOAT_THREAD_LOCAL Numerics::DDouble::Access::ReadParameters rpMaxParams;
 
   public:
    typedef BuiltLongDouble::FloatConversion FloatConversion;
@@ -343,13 +351,20 @@ TBaseFloatInterval<TypeExecutionPath>::notifyForCompare(const TFloatInterval& so
    };
 }
 
+// FLOAT_NATIVE_INTERVAL keeps the bounds in the native format TypeImplementation
+#ifdef FLOAT_NATIVE_INTERVAL
+#define DefineCompareFloatInterval TCompareHostFloatInterval
+#else
+#define DefineCompareFloatInterval TCompareFloatInterval
+#endif
+
 template <class TypeExecutionPath, class TypeBuiltDouble, typename TypeImplementation>
-class TFloatInterval : public TCompareFloatInterval<
+class TFloatInterval : public DefineCompareFloatInterval<
       FloatDigitsHelper::TFloatDigits<long double>::UBitSizeMantissa+1,
       TBaseFloatInterval<TypeExecutionPath>, TypeBuiltDouble, TypeImplementation> {
   private:
    typedef TFloatInterval<TypeExecutionPath, TypeBuiltDouble, TypeImplementation> thisType;
-   typedef TCompareFloatInterval<
+   typedef DefineCompareFloatInterval<
       FloatDigitsHelper::TFloatDigits<long double>::UBitSizeMantissa+1,
       TBaseFloatInterval<TypeExecutionPath>, TypeBuiltDouble, TypeImplementation> inherited;
 
@@ -380,5 +395,7 @@ class TFloatInterval : public TCompareFloatInterval<
       {  return (thisType&) inherited::operator=(source); }
 };
 
+#undef DefineCompareFloatInterval
+
 }} // end of namespace NumericalDomains::DDoubleInterval
 
@@ -0,0 +1,182 @@
+/**************************************************************************/
+/*                                                                        */
+/*  Copyright (C) 2013-2025                                               */
+/*    CEA (Commissariat a l'Energie Atomique et aux Energies              */
+/*         Alternatives)                                                  */
+/*                                                                        */
+/*  you can redistribute it and/or modify it under the terms of the GNU   */
+/*  Lesser General Public License as published by the Free Software       */
+/*  Foundation, version 2.1.                                              */
+/*                                                                        */
+/*  It is distributed in the hope that it will be useful,                 */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         */
+/*  GNU Lesser General Public License for more details.                   */
+/*                                                                        */
+/*  See the GNU Lesser General Public License version 2.1                 */
+/*  for more details (enclosed in the file LICENSE).                      */
+/*                                                                        */
+/**************************************************************************/
+
+/////////////////////////////////
+//
+// Library   : NumericalDomains
+// Unit      : Affine relationships
+// File      : branch_paths.cpp
+// Description :
+//   Micro-benchmark of the branch paths of the affine option: indexing of a
+//   vector with a heavily branched integer, by enumeration of the paths of
+//   the index and by selection over the nodes of its decision diagram.
+//
+
+#include "FloatAffineOption.template"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+using namespace NumericalDomains;
+
+namespace {
+
+class Chronometer {
+  private:
+   std::chrono::steady_clock::time_point tpStart = std::chrono::steady_clock::now();
+
+  public:
+   double nanoseconds(int operations) const
+      {  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - tpStart;
+         return elapsed.count() / (operations > 0 ? operations : 1);
+      }
+};
+
+typedef TFldlibIntegerBranchOption<int> Integer;
+
+// number of the conditions 1..conditions that hold, with 2^conditions paths
+Integer
+buildCount(int conditions) {
+   Integer result(0);
+   for (int condition = 1; condition <= conditions; ++condition) {
+      FldlibBase::BranchPath path;
+      path.push_back(condition, true);
+      Integer next(result);
+      next += 1;
+      result.conditionalAssigns(path, next);
+   }
+   return result;
+}
+
+bool
+isSame(const Integer& first, const Integer& second) {
+   if (!first.conditionalValue || !second.conditionalValue)
+      return !first.conditionalValue && !second.conditionalValue && first.value == second.value;
+   bool result = true;
+   first.conditionalValue->apply(*second.conditionalValue,
+      std::function<void (const int&, const int&)>([&result](const int& firstValue, const int& secondValue)
+         {  if (firstValue != secondValue)
+               result = false;
+         }));
+   return result;
+}
+
+bool
+benchmark(int conditions, bool doesEnumerate) {
+   Integer index = buildCount(conditions);
+   TFLDLibVectorBranchOption<Integer> vector;
+   for (int element = 0; element <= conditions; ++element)
+      vector.push_back(Integer(element*element));
+
+   // cursor steps along the paths of the index
+   double pathTime = 0;
+   int paths = 0;
+   if (doesEnumerate) {
+      Chronometer cursorChronometer;
+      Integer::BranchCursor cursor(index);
+      while (cursor.setToNext())
+         ++paths;
+      pathTime = cursorChronometer.nanoseconds(paths);
+   }
+
+   // indexing by enumeration of the paths
+   Integer enumerated;
+   double enumerationTime = 0;
+   if (doesEnumerate) {
+      Chronometer enumerationChronometer;
+      Integer::BranchCursor cursor(index);
+      while (cursor.setToNext())
+         enumerated.conditionalAssigns(cursor.getPathAt(), vector.ccontent()[cursor.elementAt()]);
+      enumerationTime = enumerationChronometer.nanoseconds(1);
+   }
+
+   // indexing by selection over the decision diagram
+   Chronometer selectionChronometer;
+   Integer selected = vector[index];
+   double selectionTime = selectionChronometer.nanoseconds(1);
+
+   bool result = selected.getMinValue() == 0 && selected.getMaxValue() == conditions*conditions;
+   if (doesEnumerate)
+      result = result && isSame(selected, enumerated);
+   if (doesEnumerate)
+      printf("%4d conditions: %8d paths, cursor step %6.1f ns, enumeration %10.1f us, selection %8.1f us%s\n",
+            conditions, paths, pathTime, enumerationTime/1000.0, selectionTime/1000.0, result ? "" : " [error]");
+   else
+      printf("%4d conditions: %8s paths, selection %8.1f us%s\n",
+            conditions, "2^n", selectionTime/1000.0, result ? "" : " [error]");
+   return result;
+}
+
+// merge of two interleaved paths, the steps of the second one are inserted in the first one
+bool
+benchmarkMerge(int length, int steps) {
+   FldlibBase::BranchPath evenPath, oddPath;
+   for (int index = 0; index < length; ++index) {
+      evenPath.push_back(2*index, true);
+      oddPath.push_back(2*index+1, index % 2 == 0);
+   }
+   bool result = true;
+   Chronometer mergeChronometer;
+   for (int step = 0; step < steps; ++step) {
+      FldlibBase::BranchPath path(evenPath);
+      result = FldlibBase::mergePath(path, oddPath) && result;
+      result = result && path.size() == 2*length;
+   }
+   double mergeTime = mergeChronometer.nanoseconds(steps);
+
+   FldlibBase::BranchPath mergedPath(evenPath), otherMergedPath(oddPath);
+   result = FldlibBase::mergePath(mergedPath, oddPath) && FldlibBase::mergePath(otherMergedPath, evenPath)
+      && mergedPath == otherMergedPath && result;
+   Chronometer findChronometer;
+   int found = 0;
+   for (int step = 0; step < steps; ++step) {
+      const FldlibBase::BranchPath::Step* pathStep = mergedPath.find(step % (2*length));
+      if (pathStep && pathStep->direction == (step % 2 == 0 || step % 4 == 1))
+         ++found;
+   }
+   double findTime = findChronometer.nanoseconds(steps);
+   result = result && found == steps;
+
+   FldlibBase::BranchPath conflictPath(evenPath);
+   FldlibBase::BranchPath oppositePath;
+   oppositePath.push_back(2*(length/2), false);
+   result = result && !FldlibBase::mergePath(conflictPath, oppositePath);
+   printf("%6d steps: merge %10.1f ns, find %6.1f ns%s\n", length, mergeTime, findTime,
+         result ? "" : " [error]");
+   return result;
+}
+
+} // end of namespace
+
+int
+main(int argc, char** argv) {
+   bool isQuick = argc > 1 && strcmp(argv[1], "--quick") == 0;
+   int maxEnumeratedConditions = isQuick ? 10 : 14;
+   int maxSelectedConditions = isQuick ? 32 : 64;
+   bool result = true;
+   for (int conditions = 4; conditions <= maxEnumeratedConditions; conditions += 2)
+      result = benchmark(conditions, true) && result;
+   for (int conditions = 32; conditions <= maxSelectedConditions; conditions *= 2)
+      result = benchmark(conditions, false) && result;
+   for (int length = 16; length <= (isQuick ? 256 : 4096); length *= 4)
+      result = benchmarkMerge(length, isQuick ? 1000 : 10000) && result;
+   return result ? 0 : 1;
+}
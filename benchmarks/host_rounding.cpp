@@ -0,0 +1,163 @@
+/**************************************************************************/
+/*                                                                        */
+/*  Copyright (C) 2005-2025                                               */
+/*    CEA (Commissariat a l'Energie Atomique et aux Energies              */
+/*         Alternatives)                                                  */
+/*                                                                        */
+/*  you can redistribute it and/or modify it under the terms of the GNU   */
+/*  Lesser General Public License as published by the Free Software       */
+/*  Foundation, version 2.1.                                              */
+/*                                                                        */
+/*  It is distributed in the hope that it will be useful,                 */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         */
+/*  GNU Lesser General Public License for more details.                   */
+/*                                                                        */
+/*  See the GNU Lesser General Public License version 2.1                 */
+/*  for more details (enclosed in the file LICENSE).                      */
+/*                                                                        */
+/**************************************************************************/
+
+/////////////////////////////////
+//
+// Library   : ForwardNumerics
+// Unit      : Floating
+// File      : host_rounding.cpp
+// Description :
+//   Micro-benchmark of the directed rounding of native floating points:
+//   a rounding mode set around every operation, a mode set once per batch
+//   and a mode fixed upward with the lowest bound computed as -((-a) op b).
+//
+
+#include "Numerics/HostFloating.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+
+typedef Numerics::TDoubleElement<Numerics::TFloatingBase<Numerics::DoubleTraits> > Double;
+typedef Numerics::DDouble::Access::ReadParameters ReadParameters;
+typedef Numerics::HostRoundingModeGuard HostRoundingModeGuard;
+
+class Chronometer {
+  private:
+   std::chrono::steady_clock::time_point tpStart = std::chrono::steady_clock::now();
+
+  public:
+   double nanoseconds(int operations) const
+      {  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - tpStart;
+         return elapsed.count() / (operations > 0 ? operations : 1);
+      }
+};
+
+struct Bounds {
+   Double min, max;
+   bool operator==(const Bounds& source) const
+      {  return memcmp(&min.implementation(), &source.min.implementation(), sizeof(double)) == 0
+            && memcmp(&max.implementation(), &source.max.implementation(), sizeof(double)) == 0;
+      }
+};
+
+// enclosure of sum_i (x_i*y_i - z_i)/w_i, one rounding mode change around each operation
+Bounds
+perOperation(const std::vector<Double>& values, const ReadParameters& minParams,
+      const ReadParameters& maxParams) {
+   Bounds result;
+   ReadParameters params[2] = { minParams, maxParams };
+   for (size_t index = 0; index+3 < values.size(); index += 4) {
+      for (int bound = 0; bound < 2; ++bound) {
+         Double term(values[index]);
+         term.multAssign(values[index+1], params[bound]);
+         term.minusAssign(values[index+2], params[bound]);
+         term.divAssign(values[index+3], params[bound]);
+         (bound == 0 ? result.min : result.max).plusAssign(term, params[bound]);
+      };
+   };
+   return result;
+}
+
+// same enclosure, one rounding mode change for each bound of the whole sequence
+Bounds
+perBatch(const std::vector<Double>& values, const ReadParameters& minParams,
+      const ReadParameters& maxParams) {
+   Bounds result;
+   {  HostRoundingModeGuard guard(minParams);
+      for (size_t index = 0; index+3 < values.size(); index += 4)
+         result.min += (values[index]*values[index+1]-values[index+2])/values[index+3];
+   }
+   {  HostRoundingModeGuard guard(maxParams);
+      for (size_t index = 0; index+3 < values.size(); index += 4)
+         result.max += (values[index]*values[index+1]-values[index+2])/values[index+3];
+   }
+   return result;
+}
+
+// same enclosure in a single upward mode, both bounds within the same pass
+Bounds
+upward(const std::vector<Double>& values, const ReadParameters& minParams,
+      const ReadParameters& maxParams) {
+   Bounds result;
+   HostRoundingModeGuard guard(HostRoundingModeGuard::getUpwardMode());
+   for (size_t index = 0; index+3 < values.size(); index += 4) {
+      Double min(values[index]), max(values[index]);
+      min.multAssignUpward(values[index+1], minParams).minusAssignUpward(values[index+2], minParams)
+         .divAssignUpward(values[index+3], minParams);
+      max.multAssignUpward(values[index+1], maxParams).minusAssignUpward(values[index+2], maxParams)
+         .divAssignUpward(values[index+3], maxParams);
+      result.min.plusAssignUpward(min, minParams);
+      result.max.plusAssignUpward(max, maxParams);
+   };
+   return result;
+}
+
+template <class Enclose>
+double
+measure(Enclose enclose, const std::vector<Double>& values, int repetitions, Bounds& result) {
+   Chronometer chronometer;
+   for (int repetition = 0; repetition < repetitions; ++repetition)
+      result = enclose(values);
+   return chronometer.nanoseconds(repetitions * (int) (values.size()/4) * 8);
+}
+
+} // end of namespace
+
+int
+main(int argc, char** argv) {
+   bool isQuick = argc > 1 && strcmp(argv[1], "--quick") == 0;
+   ReadParameters minParams, maxParams;
+   minParams.setLowestRound();
+   maxParams.setHighestRound();
+
+   std::mt19937_64 generator(4);
+   std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+   std::vector<Double> values(4096);
+   for (auto& value : values) {
+      value = Double(distribution(generator));
+      if (value.isZero())
+         value = Double(0.5);
+   };
+
+   int repetitions = isQuick ? 20 : 2000;
+   Bounds perOperationBounds, perBatchBounds, upwardBounds;
+   double perOperationTime = measure([&](const std::vector<Double>& values)
+         {  return perOperation(values, minParams, maxParams); }, values, repetitions, perOperationBounds);
+   double perBatchTime = measure([&](const std::vector<Double>& values)
+         {  return perBatch(values, minParams, maxParams); }, values, repetitions, perBatchBounds);
+   double upwardTime = measure([&](const std::vector<Double>& values)
+         {  return upward(values, minParams, maxParams); }, values, repetitions, upwardBounds);
+
+   bool isSound = perOperationBounds.min.implementation() <= perOperationBounds.max.implementation();
+   bool isDirected = perOperationBounds.min.implementation() < perOperationBounds.max.implementation();
+   bool result = isSound && perBatchBounds == upwardBounds
+      && (perOperationBounds == upwardBounds || !isDirected);
+   printf("rounding mode per operation %6.2f ns, per batch %6.2f ns, upward only %6.2f ns\n",
+         perOperationTime, perBatchTime, upwardTime);
+   printf("enclosure [%.17g, %.17g]%s%s\n", upwardBounds.min.implementation(),
+         upwardBounds.max.implementation(), isDirected ? "" : " (no directed rounding on this host)",
+         result ? "" : " [error]");
+   return result ? 0 : 1;
+}
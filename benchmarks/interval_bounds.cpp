@@ -0,0 +1,141 @@
+/**************************************************************************/
+/*                                                                        */
+/*  Copyright (C) 2013-2025                                               */
+/*    CEA (Commissariat a l'Energie Atomique et aux Energies              */
+/*         Alternatives)                                                  */
+/*                                                                        */
+/*  you can redistribute it and/or modify it under the terms of the GNU   */
+/*  Lesser General Public License as published by the Free Software       */
+/*  Foundation, version 2.1.                                              */
+/*                                                                        */
+/*  It is distributed in the hope that it will be useful,                 */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         */
+/*  GNU Lesser General Public License for more details.                   */
+/*                                                                        */
+/*  See the GNU Lesser General Public License version 2.1                 */
+/*  for more details (enclosed in the file LICENSE).                      */
+/*                                                                        */
+/**************************************************************************/
+
+/////////////////////////////////
+//
+// Library   : NumericalDomains
+// Unit      : Interval
+// File      : interval_bounds.cpp
+// Description :
+//   Micro-benchmark of the bounds of the interval domain: soft floating point
+//   bounds of TCompareFloatInterval against the native bounds of
+//   TCompareHostFloatInterval, with a check that the native bounds enclose
+//   the soft ones.
+//
+
+#include "fldlib_config.h"
+#include "NumericalAnalysis/FloatIntervalExecutionPath.template"
+#include "NumericalDomains/FloatIntervalHost.template"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace NumericalDomains::DDoubleInterval;
+
+namespace {
+
+class Chronometer {
+  private:
+   std::chrono::steady_clock::time_point tpStart = std::chrono::steady_clock::now();
+
+  public:
+   double nanoseconds(int operations) const
+      {  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - tpStart;
+         return elapsed.count() / (operations > 0 ? operations : 1);
+      }
+};
+
+// no output, no trace: only the operations on the bounds are measured
+class BaseInterval : public TBaseFloatIntervalContract<void> {
+  public:
+   typedef BaseExecutionPath::FloatConversion FloatConversion;
+   typedef BaseExecutionPath::FloatDigitsHelper FloatDigitsHelper;
+   static Numerics::DDouble::Access::ReadParameters& minParams() { return BaseExecutionPath::minParams(); }
+   static Numerics::DDouble::Access::ReadParameters& maxParams() { return BaseExecutionPath::maxParams(); }
+};
+
+template <class TypeBuiltDouble, typename TypeImplementation>
+struct TIntervals {
+   typedef TCompareFloatInterval<FloatDigitsHelper::TFloatDigits<long double>::UBitSizeMantissa+1,
+         BaseInterval, TypeBuiltDouble, TypeImplementation> Soft;
+   typedef TCompareHostFloatInterval<FloatDigitsHelper::TFloatDigits<long double>::UBitSizeMantissa+1,
+         BaseInterval, TypeBuiltDouble, TypeImplementation> Native;
+};
+
+template <class TypeInterval, typename TypeImplementation>
+TypeInterval
+constant(TypeImplementation value) {
+   TypeInterval result;
+   result.initFrom(value);
+   return result;
+}
+
+// enclosure of sum_i ((x_i*y_i - z_i)/w_i) with a refinement of the sum by a comparison
+template <class TypeInterval, typename TypeImplementation>
+TypeInterval
+evaluate(const std::vector<TypeImplementation>& values) {
+   TypeInterval result(0);
+   TypeInterval bound(-1e6, 1e6);
+   for (size_t index = 0; index+3 < values.size(); index += 4) {
+      TypeInterval term(values[index], values[index]+(TypeImplementation) 0.125);
+      term *= constant<TypeInterval>(values[index+1]);
+      term -= constant<TypeInterval>(values[index+2]);
+      term /= constant<TypeInterval>((TypeImplementation) 2 + values[index+3]);
+      result += term;
+      if (result < bound)
+         bound = TypeInterval(-1e6, 1e6);
+   };
+   return result;
+}
+
+template <class TypeBuiltDouble, typename TypeImplementation>
+bool
+benchmark(const char* name, int operations, std::mt19937_64& generator) {
+   typedef TIntervals<TypeBuiltDouble, TypeImplementation> Intervals;
+   std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+   std::vector<TypeImplementation> values(4*operations);
+   for (auto& value : values)
+      value = (TypeImplementation) distribution(generator);
+
+   Chronometer softChronometer;
+   typename Intervals::Soft soft = evaluate<typename Intervals::Soft>(values);
+   double softTime = softChronometer.nanoseconds(operations);
+
+   Chronometer nativeChronometer;
+   typename Intervals::Native native = evaluate<typename Intervals::Native>(values);
+   double nativeTime = nativeChronometer.nanoseconds(operations);
+
+   // the native bounds may be one native ulp wider than the soft ones
+   bool result = native.min() <= soft.min() && native.max() >= soft.max();
+   TypeImplementation softMin, softMax, nativeMin, nativeMax;
+   soft.retrieveImplementationBounds(softMin, softMax);
+   native.retrieveImplementationBounds(nativeMin, nativeMax);
+   printf("%-12s: soft %8.1f ns, native %6.1f ns per term, speedup %5.1f, width soft %.3Le native %.3Le%s\n",
+         name, softTime, nativeTime, nativeTime > 0 ? softTime/nativeTime : 0.0,
+         (long double) (softMax - softMin), (long double) (nativeMax - nativeMin), result ? "" : " [error]");
+   return result;
+}
+
+} // end of namespace
+
+int
+main(int argc, char** argv) {
+   bool isQuick = argc > 1 && strcmp(argv[1], "--quick") == 0;
+   int operations = isQuick ? 2000 : 200000;
+   BaseExecutionPath::initializeMinMaxParams();
+   std::mt19937_64 generator(4);
+   bool result = benchmark<BuiltFloat, float>("float", operations, generator);
+   result = benchmark<BuiltDouble, double>("double", operations, generator) && result;
+   result = benchmark<BuiltLongDouble, long double>("long double", operations, generator) && result;
+   return result ? 0 : 1;
+}
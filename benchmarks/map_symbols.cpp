@@ -0,0 +1,135 @@
+/**************************************************************************/
+/*                                                                        */
+/*  Copyright (C) 2011-2025                                               */
+/*    CEA (Commissariat a l'Energie Atomique et aux Energies              */
+/*         Alternatives)                                                  */
+/*                                                                        */
+/*  you can redistribute it and/or modify it under the terms of the GNU   */
+/*  Lesser General Public License as published by the Free Software       */
+/*  Foundation, version 2.1.                                              */
+/*                                                                        */
+/*  It is distributed in the hope that it will be useful,                 */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         */
+/*  GNU Lesser General Public License for more details.                   */
+/*                                                                        */
+/*  See the GNU Lesser General Public License version 2.1                 */
+/*  for more details (enclosed in the file LICENSE).                      */
+/*                                                                        */
+/**************************************************************************/
+
+/////////////////////////////////
+//
+// Library   : NumericalDomains
+// Unit      : BackTrace
+// File      : map_symbols.cpp
+// Description :
+//   Micro-benchmark of the creation of noise symbols without the map of symbols,
+//   with the eager symbolization of the backtraces and with the deferred one.
+//
+
+#include "NumericalLattices/FloatAffineBaseCommon.h"
+#include "NumericalAnalysis/BackTrace.h"
+#include "Pointer/Vector.template"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace NumericalDomains::DAffine;
+
+namespace {
+
+class Chronometer {
+  private:
+   std::chrono::steady_clock::time_point tpStart = std::chrono::steady_clock::now();
+
+  public:
+   double nanoseconds(int operations) const
+      {  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - tpStart;
+         return elapsed.count() / (operations > 0 ? operations : 1);
+      }
+};
+
+enum MapMode { MMOff, MMEager, MMDeferred };
+
+void
+createSymbols(MapMode mode, int symbolsNumber, STG::IOObject::OSBuffer& out,
+      NumericalDomains::SimplifiedBackTraces& backTraces) {
+   SymbolsManager manager;
+   std::vector<Symbol*> symbols;
+   for (int index = 0; index < symbolsNumber; ++index) {
+      Symbol* symbol = manager.createNoiseSymbol();
+      if (mode == MMEager) {
+         out.writesome(symbol->getOwnPrefix());
+         out.write(symbol->getOrder(), false);
+         out.writesome(": ");
+         NumericalDomains::writeSimplifiedBackTrace(out);
+         out.put('\n');
+      }
+      else if (mode == MMDeferred) {
+         backTraces.record();
+         symbols.push_back(symbol);
+      };
+   };
+   for (int index = 0; index < backTraces.count(); ++index) {
+      out.writesome(symbols[index]->getOwnPrefix());
+      out.write(symbols[index]->getOrder(), false);
+      out.writesome(": ");
+      backTraces.write(out, index);
+      out.put('\n');
+   };
+}
+
+// the first frame is the call site in createSymbols, which differs between both modes
+std::string
+removeCallSites(const std::string& map) {
+   std::string result;
+   size_t position = 0;
+   while (position < map.length()) {
+      size_t end = map.find('\n', position);
+      if (end == std::string::npos)
+         end = map.length();
+      size_t frames = map.find("], ", position);
+      result.append(map, position, map.find(": ", position) + 2 - position);
+      if (frames != std::string::npos && frames < end)
+         result.append(map, frames + 3, end - frames - 3);
+      result.push_back('\n');
+      position = end + 1;
+   };
+   return result;
+}
+
+bool
+benchmark(int symbolsNumber) {
+   STG::IOObject::OSBuffer maps[3];
+   NumericalDomains::SimplifiedBackTraces backTraces[3];
+   double times[3];
+   // a single call site, so that both maps share the frames above createSymbols
+   for (MapMode mode : { MMOff, MMEager, MMDeferred }) {
+      Chronometer chronometer;
+      createSymbols(mode, symbolsNumber, maps[mode], backTraces[mode]);
+      times[mode] = chronometer.nanoseconds(symbolsNumber);
+   };
+
+   bool result = maps[MMOff].buffer().empty() && backTraces[MMDeferred].count() == symbolsNumber
+      && removeCallSites(maps[MMEager].buffer()) == removeCallSites(maps[MMDeferred].buffer());
+   printf("%7d symbols: map off %8.1f ns, eager map %10.1f ns, deferred map %8.1f ns"
+         " (%d symbolized frames)%s\n", symbolsNumber, times[MMOff], times[MMEager], times[MMDeferred],
+         backTraces[MMDeferred].countSymbolizedFrames(), result ? "" : " [error]");
+   return result;
+}
+
+} // end of namespace
+
+int
+main(int argc, char** argv) {
+   bool isQuick = argc > 1 && strcmp(argv[1], "--quick") == 0;
+   int maxSymbols = isQuick ? 10000 : 100000;
+   bool result = true;
+   for (int symbolsNumber = 1000; symbolsNumber <= maxSymbols; symbolsNumber *= 10)
+      result = benchmark(symbolsNumber) && result;
+   return result ? 0 : 1;
+}
@@ -0,0 +1,123 @@
+/**************************************************************************/
+/*                                                                        */
+/*  Copyright (C) 2013-2025                                               */
+/*    CEA (Commissariat a l'Energie Atomique et aux Energies              */
+/*         Alternatives)                                                  */
+/*                                                                        */
+/*  you can redistribute it and/or modify it under the terms of the GNU   */
+/*  Lesser General Public License as published by the Free Software       */
+/*  Foundation, version 2.1.                                              */
+/*                                                                        */
+/*  It is distributed in the hope that it will be useful,                 */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         */
+/*  GNU Lesser General Public License for more details.                   */
+/*                                                                        */
+/*  See the GNU Lesser General Public License version 2.1                 */
+/*  for more details (enclosed in the file LICENSE).                      */
+/*                                                                        */
+/**************************************************************************/
+
+/////////////////////////////////
+//
+// Library   : Pointer
+// Unit      : Allocation
+// File      : node_pool.cpp
+// Description :
+//   Micro-benchmark of the node pool against the global allocator with the
+//   allocation pattern of the symbols and of the coefficients.
+//
+
+#include "NumericalLattices/FloatAffineBaseCommon.h"
+#include "Pointer/Vector.template"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <random>
+#include <vector>
+
+using namespace NumericalDomains::DAffine;
+
+namespace {
+
+class Chronometer {
+  private:
+   std::chrono::steady_clock::time_point tpStart = std::chrono::steady_clock::now();
+
+  public:
+   double nanoseconds(int operations) const
+      {  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - tpStart;
+         return elapsed.count() / (operations > 0 ? operations : 1);
+      }
+};
+
+// live nodes of mixed sizes, each step frees a random node and allocates a new one
+template <class Allocate, class Free>
+double
+churn(int liveNodes, int steps, Allocate allocate, Free free) {
+   static const size_t sizes[] = { 48, 64, 96, 128 };
+   std::mt19937 generator(liveNodes);
+   std::uniform_int_distribution<int> distribution(0, liveNodes-1);
+   std::vector<std::pair<void*, size_t> > nodes(liveNodes);
+   Chronometer chronometer;
+   for (int index = 0; index < liveNodes; ++index) {
+      size_t size = sizes[index % 4];
+      nodes[index] = std::make_pair(allocate(size), size);
+   };
+   for (int step = 0; step < steps; ++step) {
+      auto& node = nodes[distribution(generator)];
+      free(node.first, node.second);
+      node.second = sizes[step % 4];
+      node.first = allocate(node.second);
+      memset(node.first, 0, node.second);
+   };
+   for (auto& node : nodes)
+      free(node.first, node.second);
+   return chronometer.nanoseconds(2*liveNodes + 2*steps);
+}
+
+bool
+benchmark(int liveNodes, int steps) {
+   double globalTime = churn(liveNodes, steps,
+         [](size_t size) { return ::operator new(size); },
+         [](void* block, size_t size) { ::operator delete(block, size); });
+   double poolTime = churn(liveNodes, steps,
+         [](size_t size) { return PNT::NodePool::allocate(size); },
+         [](void* block, size_t size) { PNT::NodePool::free(block, size); });
+   bool result = PNT::NodePool::queryLiveBlocksNumber() == 0;
+   size_t chunks = PNT::NodePool::queryChunksNumber();
+   PNT::NodePool::reclaim();
+   result = result && PNT::NodePool::queryChunksNumber() == 0;
+
+   Chronometer symbols;
+   {  SymbolsManager manager;
+      std::deque<Symbol*> symbolsQueue;
+      for (int step = 0; step < steps; ++step) {
+         symbolsQueue.push_back(manager.createNoiseSymbol());
+         if ((int) symbolsQueue.size() >= liveNodes) {
+            manager.freeSymbol(symbolsQueue.front(), true /* hasShift */);
+            symbolsQueue.pop_front();
+         };
+      };
+   }
+   double symbolsTime = symbols.nanoseconds(steps);
+   printf("%8d live nodes: global allocator %6.1f ns, pool %6.1f ns (%zu chunks), symbol create/free %7.1f ns%s\n",
+         liveNodes, globalTime, poolTime, chunks, symbolsTime, result ? "" : " [error]");
+   return result;
+}
+
+} // end of namespace
+
+int
+main(int argc, char** argv) {
+   bool isQuick = argc > 1 && strcmp(argv[1], "--quick") == 0;
+   int maxLiveNodes = isQuick ? 10000 : 1000000;
+   printf("node pool %s\n", PNT::NodePool::isActive() ? "active" : "inactive (FLDLIB_POOL_ALLOCATION=OFF)");
+   bool result = true;
+   for (int liveNodes = 1000; liveNodes <= maxLiveNodes; liveNodes *= 10)
+      result = benchmark(liveNodes, isQuick ? 100000 : 2000000) && result;
+   return result ? 0 : 1;
+}
+
@@ -0,0 +1,162 @@
+/**************************************************************************/
+/*                                                                        */
+/*  Copyright (C) 2011-2025                                               */
+/*    CEA (Commissariat a l'Energie Atomique et aux Energies              */
+/*         Alternatives)                                                  */
+/*                                                                        */
+/*  you can redistribute it and/or modify it under the terms of the GNU   */
+/*  Lesser General Public License as published by the Free Software       */
+/*  Foundation, version 2.1.                                              */
+/*                                                                        */
+/*  It is distributed in the hope that it will be useful,                 */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         */
+/*  GNU Lesser General Public License for more details.                   */
+/*                                                                        */
+/*  See the GNU Lesser General Public License version 2.1                 */
+/*  for more details (enclosed in the file LICENSE).                      */
+/*                                                                        */
+/**************************************************************************/
+
+/////////////////////////////////
+//
+// Library   : Standard classes
+// Unit      : Basic object
+// File      : stream_buffers.cpp
+// Description :
+//   Micro-benchmark of the buffered streams IOObject::ISBuffer/OSBuffer against
+//   the std::stream based IOObject::ISStream/OSStream on a synthetic trace.
+//
+
+#include "StandardClasses/Persistence.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+typedef STG::IOObject::ISBase ISBase;
+typedef STG::IOObject::OSBase OSBase;
+
+namespace {
+
+class Chronometer {
+  private:
+   std::chrono::steady_clock::time_point tpStart = std::chrono::steady_clock::now();
+
+  public:
+   double milliseconds() const
+      {  std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - tpStart;
+         return elapsed.count();
+      }
+};
+
+struct Record {
+   int order;
+   unsigned long int mask;
+   double value;
+   const char* comment;
+};
+
+// each line is like a synchronization line of the traces: a header, integers,
+// a floating-point value and a free text that is read character by character
+void
+writeTrace(OSBase& out, const std::vector<Record>& records) {
+   for (const auto& record : records) {
+      out << "ut_f " << record.order << ' ';
+      out.writeHexa(record.mask);
+      out.put(' ');
+      out << record.value << ' ';
+      out.writesome(record.comment);
+      out.put('\n');
+   };
+}
+
+double
+readTrace(ISBase& in, int& lines) {
+   double checksum = 0;
+   lines = 0;
+   while (in.canread()) {
+      int order = 0;
+      unsigned long int mask = 0;
+      double value = 0;
+      in.assume("ut_f ");
+      in >> order;
+      in.assume(' ');
+      in.readHexa(mask);
+      in.assume(' ');
+      in >> value;
+      in.assume(' ');
+      int ch;
+      while ((ch = in.get()) != '\n')
+         checksum += ch;
+      checksum += order + (double) (mask & 0xff) + value;
+      ++lines;
+   };
+   return checksum;
+}
+
+bool
+benchmark(int recordsNumber) {
+   static const char* comments[] = { "x", "path condition", "unstable branch at line 42",
+      "ut_r 4.99999999999999911182158029987e-01" };
+   std::mt19937 generator(recordsNumber);
+   std::uniform_real_distribution<double> values(-1e6, 1e6);
+   std::vector<Record> records(recordsNumber);
+   for (auto& record : records) {
+      record.order = (int) (generator() % 100000) - 50000;
+      record.mask = (unsigned long int) generator() << 16 | generator();
+      record.value = values(generator);
+      record.comment = comments[generator() % 4];
+   };
+
+   std::ostringstream stdOut;
+   Chronometer stdWrite;
+   {  STG::IOObject::OSStream out(stdOut);
+      writeTrace(out, records);
+   }
+   double stdWriteTime = stdWrite.milliseconds();
+   std::string stdTrace = stdOut.str();
+
+   STG::IOObject::OSBuffer bufferOut;
+   Chronometer bufferWrite;
+   writeTrace(bufferOut, records);
+   double bufferWriteTime = bufferWrite.milliseconds();
+   const std::string& bufferTrace = bufferOut.buffer();
+
+   int stdLines = 0, bufferLines = 0;
+   std::istringstream stdIn(stdTrace);
+   Chronometer stdRead;
+   double stdChecksum = 0;
+   {  STG::IOObject::ISStream in(stdIn);
+      stdChecksum = readTrace(in, stdLines);
+   }
+   double stdReadTime = stdRead.milliseconds();
+
+   STG::IOObject::ISBuffer bufferIn(bufferTrace.c_str(), bufferTrace.c_str() + bufferTrace.length());
+   Chronometer bufferRead;
+   double bufferChecksum = readTrace(bufferIn, bufferLines);
+   double bufferReadTime = bufferRead.milliseconds();
+
+   bool result = stdTrace == bufferTrace && stdLines == recordsNumber
+      && bufferLines == recordsNumber && stdChecksum == bufferChecksum;
+   printf("%6.1f MB trace: write %7.1f ms -> %7.1f ms, read %7.1f ms -> %7.1f ms%s\n",
+         (double) stdTrace.length() / (1024.0*1024.0), stdWriteTime, bufferWriteTime,
+         stdReadTime, bufferReadTime, result ? "" : " [error]");
+   return result;
+}
+
+} // end of namespace
+
+int
+main(int argc, char** argv) {
+   bool isQuick = argc > 1 && strcmp(argv[1], "--quick") == 0;
+   int maxRecords = isQuick ? 100000 : 1000000;
+   bool result = true;
+   for (int recordsNumber = 10000; recordsNumber <= maxRecords; recordsNumber *= 10)
+      result = benchmark(recordsNumber) && result;
+   return result ? 0 : 1;
+}
@@ -0,0 +1,129 @@
+/**************************************************************************/
+/*                                                                        */
+/*  Copyright (C) 2011-2025                                               */
+/*    CEA (Commissariat a l'Energie Atomique et aux Energies              */
+/*         Alternatives)                                                  */
+/*                                                                        */
+/*  you can redistribute it and/or modify it under the terms of the GNU   */
+/*  Lesser General Public License as published by the Free Software       */
+/*  Foundation, version 2.1.                                              */
+/*                                                                        */
+/*  It is distributed in the hope that it will be useful,                 */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         */
+/*  GNU Lesser General Public License for more details.                   */
+/*                                                                        */
+/*  See the GNU Lesser General Public License version 2.1                 */
+/*  for more details (enclosed in the file LICENSE).                      */
+/*                                                                        */
+/**************************************************************************/
+
+/////////////////////////////////
+//
+// Library   : NumericalDomains
+// Unit      : Affine relationships
+// File      : symbols_lookup.cpp
+// Description :
+//   Micro-benchmark of the lookup of symbols by order in SymbolsManager.
+//
+
+#include "NumericalLattices/FloatAffineBaseCommon.h"
+#include "Pointer/Vector.template"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace NumericalDomains::DAffine;
+
+namespace {
+
+typedef COL::TCopyCollection<COL::TList<Symbol, Symbol::Registration> > SymbolsList;
+
+class Chronometer {
+  private:
+   std::chrono::steady_clock::time_point tpStart = std::chrono::steady_clock::now();
+
+  public:
+   double nanoseconds(int operations) const
+      {  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - tpStart;
+         return elapsed.count() / (operations > 0 ? operations : 1);
+      }
+};
+
+// reverse scan of the list, as the lookup was done before the index
+Symbol*
+scanSymbol(const SymbolsList& symbols, int index) {
+   COL::TList<Symbol, Symbol::Registration>::Cursor cursor(symbols);
+   Symbol* result = nullptr;
+   while (cursor.setToPrevious() && (result = &cursor.elementSAt())->getOrder() > index);
+   return (result && result->getOrder() == index) ? result : nullptr;
+}
+
+bool
+benchmark(int symbolsNumber, int lookupsNumber, int scansNumber) {
+   std::mt19937 generator(symbolsNumber);
+   std::uniform_int_distribution<int> distribution(1, symbolsNumber);
+   std::vector<int> orders(lookupsNumber);
+   for (auto& order : orders)
+      order = distribution(generator);
+
+   SymbolsManager manager;
+   Chronometer create;
+   for (int index = 0; index < symbolsNumber; ++index)
+      manager.createNoiseSymbol();
+   double createTime = create.nanoseconds(symbolsNumber);
+
+   long long checksum = 0;
+   Chronometer lookup;
+   for (int order : orders)
+      checksum += manager.findNoiseSymbol(order).getOrder();
+   double lookupTime = lookup.nanoseconds(lookupsNumber);
+
+   SymbolsList reference;
+   for (int index = 1; index <= symbolsNumber; ++index) {
+      Symbol* symbol = new NoiseSymbol();
+      symbol->setOrder(index);
+      reference.insertNewAtEnd(symbol);
+   };
+   long long referenceChecksum = 0;
+   Chronometer scan;
+   for (int index = 0; index < scansNumber; ++index)
+      referenceChecksum += scanSymbol(reference, orders[index])->getOrder();
+   double scanTime = scan.nanoseconds(scansNumber);
+
+   std::vector<Symbol*> symbols(symbolsNumber);
+   for (int index = 0; index < symbolsNumber; ++index)
+      symbols[index] = manager.locateSymbol(Symbol::TNoise, index+1);
+   std::shuffle(symbols.begin(), symbols.end(), generator);
+   Chronometer release;
+   for (Symbol* symbol : symbols)
+      manager.freeSymbol(symbol, true /* hasShift */);
+   double freeTime = release.nanoseconds(symbolsNumber);
+
+   long long expected = 0;
+   for (int index = 0; index < scansNumber; ++index)
+      expected += orders[index];
+   bool result = manager.getCountNoiseSymbols() == 0 && referenceChecksum == expected;
+   for (int index = scansNumber; index < lookupsNumber; ++index)
+      expected += orders[index];
+   result = result && checksum == expected;
+   printf("%8d symbols: create %7.1f ns, indexed lookup %7.1f ns, list scan %11.1f ns, free %7.1f ns%s\n",
+         symbolsNumber, createTime, lookupTime, scanTime, freeTime, result ? "" : " [error]");
+   return result;
+}
+
+} // end of namespace
+
+int
+main(int argc, char** argv) {
+   bool isQuick = argc > 1 && strcmp(argv[1], "--quick") == 0;
+   int maxSymbols = isQuick ? 10000 : 1000000;
+   bool result = true;
+   for (int symbolsNumber = 1000; symbolsNumber <= maxSymbols; symbolsNumber *= 10)
+      result = benchmark(symbolsNumber, 100000, isQuick ? 100 : 1000) && result;
+   return result ? 0 : 1;
+}
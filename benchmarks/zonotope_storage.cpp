@@ -0,0 +1,118 @@
+/**************************************************************************/
+/*                                                                        */
+/*  Copyright (C) 2013-2025                                               */
+/*    CEA (Commissariat a l'Energie Atomique et aux Energies              */
+/*         Alternatives)                                                  */
+/*                                                                        */
+/*  you can redistribute it and/or modify it under the terms of the GNU   */
+/*  Lesser General Public License as published by the Free Software       */
+/*  Foundation, version 2.1.                                              */
+/*                                                                        */
+/*  It is distributed in the hope that it will be useful,                 */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         */
+/*  GNU Lesser General Public License for more details.                   */
+/*                                                                        */
+/*  See the GNU Lesser General Public License version 2.1                 */
+/*  for more details (enclosed in the file LICENSE).                      */
+/*                                                                        */
+/**************************************************************************/
+
+/////////////////////////////////
+//
+// Library   : NumericalDomains
+// Unit      : Affine relationships
+// File      : zonotope_storage.cpp
+// Description :
+//   Micro-benchmark of the storage of the lazy zonotopes of the affine
+//   option: heap allocations and time of the temporaries of an arithmetic
+//   kernel and of the saved copies of its variables.
+//
+
+#include "FloatAffineOption.template"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+using namespace NumericalDomains;
+
+namespace {
+
+size_t heapAllocations = 0;
+
+}
+
+// every allocation of the program is counted, including the ones of the library
+void*
+operator new(size_t size) {
+   ++heapAllocations;
+   if (void* result = std::malloc(size > 0 ? size : 1))
+      return result;
+   throw std::bad_alloc();
+}
+
+void operator delete(void* block) noexcept { std::free(block); }
+void operator delete(void* block, size_t) noexcept { std::free(block); }
+
+namespace {
+
+class Chronometer {
+  private:
+   std::chrono::steady_clock::time_point tpStart = std::chrono::steady_clock::now();
+
+  public:
+   double nanoseconds(int operations) const
+      {  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - tpStart;
+         return elapsed.count() / (operations > 0 ? operations : 1);
+      }
+};
+
+typedef TFldlibZonotopeOption<double> Real;
+
+// Horner evaluation of a polynomial on an uncertain input, the value of each step
+//   being saved as the loops of an instrumented program do before their body
+bool
+benchmark(int degree, int evaluations) {
+   typedef Real::ZonotopePointer::Statistics Statistics;
+   Real input(0.9, 1.1);
+   size_t startAllocations = heapAllocations;
+   Statistics startStatistics = Real::ZonotopePointer::queryStatistics();
+   Chronometer chronometer;
+   bool hasZonotopes = true;
+   double value = 0;
+   for (int evaluation = 0; evaluation < evaluations; ++evaluation) {
+      Real result(1.0);
+      for (int power = 1; power <= degree; ++power) {
+         Real save(result);
+         save.cloneShareParts();
+         result = result*input + 1.0/(power+1);
+      }
+      hasZonotopes = hasZonotopes && result.zonotope;
+      value = result.value;
+   }
+   int operations = evaluations*degree;
+   double time = chronometer.nanoseconds(operations);
+   double allocations = (double) (heapAllocations - startAllocations) / operations;
+   const Statistics& statistics = Real::ZonotopePointer::queryStatistics();
+   double systemNodes = (double) (statistics.systemAllocations - startStatistics.systemAllocations) / operations;
+   double reusedNodes = (double) (statistics.reusedAllocations - startStatistics.reusedAllocations) / operations;
+   bool result = hasZonotopes && value > 1.0 && statistics.liveNodes == startStatistics.liveNodes;
+   printf("degree %3d: %6.2f heap allocations, zonotopes %6.3f allocated %6.2f reused, %8.1f ns per step%s\n",
+         degree, allocations, systemNodes, reusedNodes, time, result ? "" : " [error]");
+   return result;
+}
+
+} // end of namespace
+
+int
+main(int argc, char** argv) {
+   bool isQuick = argc > 1 && strcmp(argv[1], "--quick") == 0;
+   FldlibBase::active = true;
+   bool result = true;
+   for (int degree = 4; degree <= 16; degree *= 2)
+      result = benchmark(degree, isQuick ? 200 : 5000) && result;
+   return result ? 0 : 1;
+}
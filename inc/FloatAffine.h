@@ -671,6 +671,20 @@ class TInstrumentedFloatZonotope : public TFloatZonotope<ExecutionPath, USizeMan
       }
    template <typename TypeValue> TInstrumentedFloatZonotope(TypeValue value) requires std::integral<TypeValue>
       :  inherited(value) {}
+
+   typedef typename inherited::ThreadExchange ThreadExchange;
+   ThreadExchange exportToThread() const
+      {  ThreadExchange result;
+         inherited::exportToThread(result);
+         return result;
+      }
+   explicit TInstrumentedFloatZonotope(const ThreadExchange& exchange)
+      {  inherited::importFromThread(exchange);
+         if (inherited::doesSupportUnstableInLoop()) {
+            inherited::getSRealDomain().setHolder(inherited::currentPathExplorer);
+            inherited::getSError().setHolder(inherited::currentPathExplorer);
+         };
+      }
    TInstrumentedFloatZonotope(const thisType& source) : inherited(source)
       {  if (inherited::doesSupportUnstableInLoop()) {
             inherited::getSRealDomain().setHolder(inherited::currentPathExplorer);
@@ -435,9 +435,15 @@ class ExecutionPath {
    static void setSupportThreshold();
    static void setSupportFirstFollowFloat();
    static void setSupportPureZonotope();
+   static void setSupportBinaryTrace();
+   static void setSupportForkPaths();
+   static void setSupportSymbolsStatistics();
    static void setTrackErrorOrigin();
    static void setSupportMapSymbols();
    static void setLimitNoiseSymbolsNumber(int limit);
+   static void setNoiseSymbolsBudget(int budget);
+   static void setNoiseSymbolsMemoryLimit(int megabytes);
+   static void setTranscendentalCacheSize(int size);
    static void setSimplificationTriggerPercent(double percent);
 
    static void initializeGlobals(const char* fileSuffix);
@@ -453,9 +459,15 @@ class ExecutionPath {
       void setSupportThreshold() { ExecutionPath::setSupportThreshold(); }
       void setSupportFirstFollowFloat() { ExecutionPath::setSupportFirstFollowFloat(); }
       void setSupportPureZonotope() { ExecutionPath::setSupportPureZonotope(); }
+      void setSupportBinaryTrace() { ExecutionPath::setSupportBinaryTrace(); }
+      void setSupportForkPaths() { ExecutionPath::setSupportForkPaths(); }
+      void setSupportSymbolsStatistics() { ExecutionPath::setSupportSymbolsStatistics(); }
       void setTrackErrorOrigin() { ExecutionPath::setTrackErrorOrigin(); }
       void setSupportMapSymbols() { ExecutionPath::setSupportMapSymbols(); }
       void setLimitNoiseSymbolsNumber(int limit) { ExecutionPath::setLimitNoiseSymbolsNumber(limit); }
+      void setNoiseSymbolsBudget(int budget) { ExecutionPath::setNoiseSymbolsBudget(budget); }
+      void setNoiseSymbolsMemoryLimit(int megabytes) { ExecutionPath::setNoiseSymbolsMemoryLimit(megabytes); }
+      void setTranscendentalCacheSize(int size) { ExecutionPath::setTranscendentalCacheSize(size); }
       void setResultFile(const char* fileSuffix) { initializeGlobals(fileSuffix); }
       void setSimplificationTriggerPercent(double percent) { ExecutionPath::setSimplificationTriggerPercent(percent); }
       ~Initialization() { finalizeGlobals(); }
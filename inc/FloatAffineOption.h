@@ -32,6 +32,8 @@
 
 #include "FloatAffine.h"
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
 
 struct NotYetImplemented {};
 
@@ -144,38 +146,118 @@ class TFldlibFloatingBranchOption;
 
 class FldlibBase : public DAffine::ExecutionPath {
   public:
-   static int numberOfBranches;
-   static int splitBranchIdentifier;
-   static bool active;
+   static FLOAT_THREAD_LOCAL int numberOfBranches;
+   static FLOAT_THREAD_LOCAL int splitBranchIdentifier;
+   static FLOAT_THREAD_LOCAL bool active;
 
   public:
    template<typename DoubleType>
    class TFloatZonotope {
    };
 
-   static bool mergePath(std::vector<std::pair<int, bool>>& path, const std::vector<std::pair<int, bool>>& source)
-      {  size_t thisIndex = 0, sourceIndex = 0;
-         while (thisIndex < path.size() && sourceIndex < source.size()) {
-            if (path[thisIndex].first < source[sourceIndex].first)
-               ++thisIndex;
-            else if (path[thisIndex].first > source[sourceIndex].first) {
-               path.insert(path.begin() + thisIndex, source[sourceIndex]);
-               ++sourceIndex;
+   // A branch path is the sequence of the (merge branch index, direction) decisions that leads
+   //   to a leaf of a TValueWithBranches, sorted by increasing merge branch index.
+   // It is a persistent list whose steps are interned by a per-thread table: the copy, the
+   //   extension and the removal of the last step take constant time and two paths are equal
+   //   iff they share the same last step. Each step has a skew-binary jump pointer to one
+   //   of its ancestors such that the step of a given merge branch index is found in
+   //   logarithmic time.
+   class BranchPath {
+     public:
+      struct Step {
+         int mergeBranchIndex;
+         bool direction;
+         int length;
+         std::shared_ptr<const Step> previous;
+         const Step* jump; // ancestor kept alive by previous, nullptr for the empty path
+
+         Step(int mergeBranchIndexSource, bool directionSource,
+               const std::shared_ptr<const Step>& previousSource);
+      };
+
+     private:
+      std::shared_ptr<const Step> spLast;
+
+      struct StepKey {
+         const Step* previous;
+         int mergeBranchIndex;
+         bool direction;
+
+         bool operator==(const StepKey& source) const = default;
+      };
+      struct StepKeyHash {
+         size_t operator()(const StepKey& key) const
+            {  size_t result = std::hash<const Step*>()(key.previous);
+               result = result*31 + std::hash<int>()(key.mergeBranchIndex);
+               return result*2 + (key.direction ? 1 : 0);
             }
-            else { // path[thisIndex].first == source[sourceIndex].first
-               if (path[thisIndex].second == source[sourceIndex].second) {
-                  ++thisIndex;
-                  ++sourceIndex;
-               }
-               else
-                  return false;
+      };
+      struct InternTable {
+         std::unordered_map<StepKey, std::weak_ptr<const Step>, StepKeyHash> steps;
+         size_t sweepThreshold = 1024;
+      };
+      static InternTable& internTable()
+         {  static FLOAT_THREAD_LOCAL InternTable result;
+            return result;
+         }
+      static std::shared_ptr<const Step> intern(const std::shared_ptr<const Step>& previous,
+            int mergeBranchIndex, bool direction);
+
+     public:
+      BranchPath() = default;
+      BranchPath(const BranchPath&) = default;
+      BranchPath(BranchPath&&) = default;
+      BranchPath& operator=(const BranchPath&) = default;
+      BranchPath& operator=(BranchPath&&) = default;
+
+      bool operator==(const BranchPath& source) const { return spLast == source.spLast; }
+      bool operator!=(const BranchPath& source) const { return spLast != source.spLast; }
+      bool empty() const { return !spLast.get(); }
+      int size() const { return spLast.get() ? spLast->length : 0; }
+      const Step& back() const { AssumeCondition(spLast.get()) return *spLast; }
+      void clear() { spLast.reset(); }
+      void push_back(int mergeBranchIndex, bool direction)
+         {  AssumeCondition(!spLast.get() || spLast->mergeBranchIndex < mergeBranchIndex)
+            spLast = intern(spLast, mergeBranchIndex, direction);
+         }
+      void pop_back()
+         {  AssumeCondition(spLast.get())
+            std::shared_ptr<const Step> previous = spLast->previous;
+            spLast = std::move(previous);
+         }
+      void setBackDirection(bool direction)
+         {  AssumeCondition(spLast.get())
+            if (spLast->direction != direction) {
+               int mergeBranchIndex = spLast->mergeBranchIndex;
+               pop_back();
+               push_back(mergeBranchIndex, direction);
             }
          }
-         return true;
-      }
+      // returns the step of mergeBranchIndex or nullptr if the path does not test it
+      const Step* find(int mergeBranchIndex) const;
+      // adds the steps of source, returns false if both paths are incompatible
+      bool mergeWith(const BranchPath& source);
+      // retrieves the steps by increasing merge branch index
+      void retrieveSteps(std::vector<std::pair<int, bool>>& steps) const
+         {  int position = size();
+            steps.resize(position);
+            for (const Step* step = spLast.get(); step; step = step->previous.get())
+               steps[--position] = std::make_pair(step->mergeBranchIndex, step->direction);
+         }
+   };
+
+   static bool mergePath(BranchPath& path, const BranchPath& source)
+      {  return path.mergeWith(source); }
+   // memoization of the binary operations on the diagrams, indexed by pairs of nodes
+   struct NodePairHash {
+      size_t operator()(const std::pair<const void*, const void*>& key) const
+         {  return std::hash<const void*>()(key.first)*31 + std::hash<const void*>()(key.second); }
+   };
+   typedef std::unordered_set<std::pair<const void*, const void*>, NodePairHash> VisitedNodePairs;
+
    class BranchCursor {
      protected:
-      std::vector<std::pair<int, bool>> path;
+      BranchPath path;
 
      public:
       BranchCursor() = default;
@@ -183,9 +265,15 @@ class FldlibBase : public DAffine::ExecutionPath {
       BranchCursor(BranchCursor&&) = default;
       BranchCursor& operator=(const BranchCursor&) = default;
       BranchCursor& operator=(BranchCursor&&) = default;
-      const std::vector<std::pair<int, bool>>& getPathAt() const { return path; }
+      const BranchPath& getPathAt() const { return path; }
    };
 
+   // The branch values are reduced decision diagrams: the subtrees are shared instead of being
+   //   copied and a node whose then and else parts are identical is replaced by this part.
+   // On integral values the nodes are moreover hash-consed by a per-thread unique table, such
+   //   that two equal subtrees are represented by the same node.
+   // The nodes are shared, hence they are copied on write (use_count() > 1) before any update.
+   // The value attached to a non-null branch is not significant.
    template<typename ValueType>
    class TValueWithBranches { // : public PNT::SharedPointer<DiscreteSymbol>
      private:
@@ -199,6 +287,119 @@ class FldlibBase : public DAffine::ExecutionPath {
 
       template <typename T> friend class TValueWithBranches;
 
+      struct NodeKey {
+         int mergeBranchIndex;
+         ValueType thenValue, elseValue;
+         const thisType* thenBranch;
+         const thisType* elseBranch;
+
+         explicit NodeKey(const thisType& node)
+            :  mergeBranchIndex(node.uMergeBranchIndex),
+               thenValue(node.spibThenBranch.get() ? ValueType() : node.uThenValue),
+               elseValue(node.spibElseBranch.get() ? ValueType() : node.uElseValue),
+               thenBranch(node.spibThenBranch.get()), elseBranch(node.spibElseBranch.get()) {}
+         bool operator==(const NodeKey& source) const = default;
+      };
+      struct NodeKeyHash {
+         size_t operator()(const NodeKey& key) const
+            {  size_t result = std::hash<int>()(key.mergeBranchIndex);
+               result = result*31 + std::hash<ValueType>()(key.thenValue);
+               result = result*31 + std::hash<const thisType*>()(key.thenBranch);
+               result = result*31 + std::hash<ValueType>()(key.elseValue);
+               return result*31 + std::hash<const thisType*>()(key.elseBranch);
+            }
+      };
+      struct UniqueTable {
+         std::unordered_map<NodeKey, std::weak_ptr<thisType>, NodeKeyHash> nodes;
+         size_t sweepThreshold = 1024;
+      };
+      static UniqueTable& uniqueTable()
+         {  static FLOAT_THREAD_LOCAL UniqueTable result;
+            return result;
+         }
+      static std::shared_ptr<thisType> hashCons(const std::shared_ptr<thisType>& node);
+
+      typedef std::unordered_map<const thisType*, std::shared_ptr<thisType>> RewrittenNodes;
+      typedef std::unordered_map<std::pair<const void*, const void*>, std::shared_ptr<thisType>,
+            NodePairHash> RewrittenNodePairs;
+      typedef std::unordered_set<const thisType*> VisitedNodes;
+      template <typename T>
+      using ConvertedNodes = std::unordered_map<const TValueWithBranches<T>*, std::shared_ptr<thisType>>;
+
+      static void copyOnWrite(std::shared_ptr<thisType>& branch)
+         {  if (branch.use_count() > 1)
+               branch.reset(new thisType(*branch));
+         }
+      template <typename T>
+      static std::shared_ptr<thisType> convertBranch(const std::shared_ptr<TValueWithBranches<T>>& source,
+            ConvertedNodes<T>& convertedNodes)
+         {  if (!source.get())
+               return std::shared_ptr<thisType>();
+            auto found = convertedNodes.find(source.get());
+            if (found != convertedNodes.end())
+               return found->second;
+            std::shared_ptr<thisType> result(new thisType(*source, convertedNodes));
+            convertedNodes.insert(std::make_pair(source.get(), result));
+            return result;
+         }
+      template <typename T> TValueWithBranches(const TValueWithBranches<T>& source,
+            ConvertedNodes<T>& convertedNodes)
+         :  uMergeBranchIndex(source.uMergeBranchIndex), uThenValue(source.uThenValue),
+            spibThenBranch(convertBranch(source.spibThenBranch, convertedNodes)),
+            uElseValue(source.uElseValue),
+            spibElseBranch(convertBranch(source.spibElseBranch, convertedNodes)) {}
+
+      // the assignments of a shared node are memoized on the remaining path and on the source
+      struct AssignmentKey {
+         const thisType* node;
+         const std::pair<int, bool>* step;
+         const void* source;
+
+         bool operator==(const AssignmentKey& key) const = default;
+      };
+      struct AssignmentKeyHash {
+         size_t operator()(const AssignmentKey& key) const
+            {  size_t result = std::hash<const void*>()(key.node);
+               result = result*31 + std::hash<const void*>()(key.step);
+               return result*31 + std::hash<const void*>()(key.source);
+            }
+      };
+      // the original nodes are kept alive such that their addresses are not reused
+      typedef std::unordered_map<AssignmentKey, std::pair<std::shared_ptr<thisType>,
+            std::shared_ptr<thisType>>, AssignmentKeyHash> RewrittenAssignments;
+
+      static void conditionalAssigns(ValueType& value, std::shared_ptr<thisType>& branch,
+            std::vector<std::pair<int, bool>>::const_iterator pathBegin,
+            std::vector<std::pair<int, bool>>::const_iterator pathEnd,
+            const ValueType& sourceValue, const std::shared_ptr<thisType>& sourceBranch,
+            RewrittenAssignments& rewrittenAssignments);
+      void conditionalAssigns(std::vector<std::pair<int, bool>>::const_iterator pathBegin,
+            std::vector<std::pair<int, bool>>::const_iterator pathEnd,
+            const ValueType& sourceValue, const std::shared_ptr<thisType>& sourceBranch,
+            RewrittenAssignments& rewrittenAssignments);
+      void applyAssign(const std::function<void (ValueType&)>& function, RewrittenNodes& rewrittenNodes);
+      template <typename T>
+      void applyAssign(const TValueWithBranches<T>& source,
+            const std::function<void (ValueType&, const T&)>& function, RewrittenNodePairs& rewrittenNodes);
+      template <typename T>
+      static void applyAssign(ValueType& thisValue, std::shared_ptr<thisType>& thisBranch,
+            const T& sourceValue, const TValueWithBranches<T>* sourceBranch,
+            const std::function<void (ValueType&, const T&)>& function, RewrittenNodePairs& rewrittenNodes);
+      void apply(const std::function<void (const ValueType&)>& function, VisitedNodes& visitedNodes) const;
+      template <typename T>
+      void apply(const TValueWithBranches<T>& source,
+            const std::function<void (const ValueType&, const T&)>& function,
+            VisitedNodePairs& visitedNodes) const;
+      template <typename T>
+      static void apply(const ValueType& thisValue, const thisType* thisBranch,
+            const T& sourceValue, const TValueWithBranches<T>* sourceBranch,
+            const std::function<void (const ValueType&, const T&)>& function, VisitedNodePairs& visitedNodes);
+      static bool isRedundant(const thisType& node);
+      static std::shared_ptr<thisType> reduce(const std::shared_ptr<thisType>& node,
+            RewrittenNodes& reducedNodes);
+      static void reduce(const ValueType*& value, std::shared_ptr<thisType>& branch,
+            RewrittenNodes& reducedNodes);
+
      public:
       TValueWithBranches(int mergeBranchIndex, const ValueType& thenValue,
             const std::shared_ptr<thisType>& thenBranch, const ValueType& elseValue,
@@ -209,20 +410,22 @@ class FldlibBase : public DAffine::ExecutionPath {
       TValueWithBranches(thisType&& source) = default;
       TValueWithBranches<ValueType>& operator=(const thisType& source) = default;
       TValueWithBranches<ValueType>& operator=(thisType&& source) = default;
+      // the converting constructors convert each shared node once
       template <typename T> TValueWithBranches(const TValueWithBranches<T>& source)
          :  uMergeBranchIndex(source.uMergeBranchIndex), uThenValue(source.uThenValue),
-            spibThenBranch(source.spibThenBranch.get() ? new thisType(*source.spibThenBranch) : nullptr),
-            uElseValue(source.uElseValue),
-            spibElseBranch(source.spibElseBranch.get() ? new thisType(*source.spibElseBranch) : nullptr) {}
+            uElseValue(source.uElseValue)
+         {  ConvertedNodes<T> convertedNodes;
+            spibThenBranch = convertBranch(source.spibThenBranch, convertedNodes);
+            spibElseBranch = convertBranch(source.spibElseBranch, convertedNodes);
+         }
       template <typename T> TValueWithBranches(TValueWithBranches<T>&& source)
-         :  uMergeBranchIndex(source.uMergeBranchIndex), uThenValue(source.uThenValue),
-            spibThenBranch(source.spibThenBranch.get() ? new thisType(*source.spibThenBranch) : nullptr),
-            uElseValue(source.uElseValue),
-            spibElseBranch(source.spibElseBranch.get() ? new thisType(*source.spibElseBranch) : nullptr) {}
+         :  TValueWithBranches(static_cast<const TValueWithBranches<T>&>(source)) {}
       void conditionalAssigns(std::vector<std::pair<int, bool>>::const_iterator pathBegin,
             std::vector<std::pair<int, bool>>::const_iterator pathEnd, const ValueType& sourceValue);
       void conditionalAssigns(std::vector<std::pair<int, bool>>::const_iterator pathBegin,
             std::vector<std::pair<int, bool>>::const_iterator pathEnd, const thisType& source);
+      // the apply methods are memoized: a shared node is rewritten or visited once,
+      //   hence function is called at least once on each value but may not see duplicates
       void applyAssign(std::function<void (ValueType&)> function);
       template <typename T>
       void applyAssign(const TValueWithBranches<T>& source,
@@ -231,6 +434,9 @@ class FldlibBase : public DAffine::ExecutionPath {
       template <typename T>
       void apply(const TValueWithBranches<T>& source,
             const std::function<void (const ValueType&, const T&)>& function) const; /* requires std::integral<T> */
+      // reduces the diagram branch and shares its nodes with the unique table;
+      //   value is updated if the diagram reduces to a constant
+      static void reduce(ValueType& value, std::shared_ptr<thisType>& branch);
       static void applyBranchAssign(int mergeBranchIndex, ValueType& thisValue,
             std::shared_ptr<TValueWithBranches<ValueType>>& thisBranch,
             const std::function<void (ValueType&,
@@ -283,12 +489,42 @@ class FldlibBase : public DAffine::ExecutionPath {
          constraint(const TValueWithBranches<T>& source,
             const std::function<bool (const ValueType&, const T&)>& function); /* requires std::integral<T> */
       int getMergeBranchIndex() const { return uMergeBranchIndex; }
+      const ValueType& getThenValue() const { return uThenValue; }
+      const ValueType& getElseValue() const { return uElseValue; }
+      const std::shared_ptr<thisType>& getThenBranch() const { return spibThenBranch; }
+      const std::shared_ptr<thisType>& getElseBranch() const { return spibElseBranch; }
       ValueType& getSThenValue() { return uThenValue; }
-      ValueType& getSElseValue() { return uThenValue; }
+      ValueType& getSElseValue() { return uElseValue; }
       std::shared_ptr<thisType>& getSThenBranch() { return spibThenBranch; }
       std::shared_ptr<thisType>& getSElseBranch() { return spibElseBranch; }
    };
 
+   // selects access(index) for the path-dependent index (value, branch) as a path-dependent
+   //   result. Each node of the reduced diagram of the index is visited once, whereas the
+   //   paths of this diagram may be exponentially many.
+   template <typename T, typename IntegerType, typename Access>
+   static T selectAt(const IntegerType& value, const TValueWithBranches<IntegerType>* branch,
+         const Access& access, std::unordered_map<const TValueWithBranches<IntegerType>*, T>& selectedNodes)
+      {  if (!branch)
+            return T(access(value));
+         auto found = selectedNodes.find(branch);
+         if (found != selectedNodes.end())
+            return found->second;
+         T result = selectAt<T>(branch->getElseValue(), branch->getElseBranch().get(), access, selectedNodes);
+         BranchPath thenPath;
+         thenPath.push_back(branch->getMergeBranchIndex(), true);
+         result.conditionalAssigns(thenPath,
+               selectAt<T>(branch->getThenValue(), branch->getThenBranch().get(), access, selectedNodes));
+         selectedNodes.insert(std::make_pair(branch, result));
+         return result;
+      }
+   template <typename T, typename IntegerType, typename Access>
+   static T selectAt(const IntegerType& value,
+         const std::shared_ptr<TValueWithBranches<IntegerType>>& branch, const Access& access)
+      {  std::unordered_map<const TValueWithBranches<IntegerType>*, T> selectedNodes;
+         return selectAt<T>(value, branch.get(), access, selectedNodes);
+      }
+
    template<typename IntegerType> requires std::integral<IntegerType>
    class TIntegerWithBranches : public TValueWithBranches<IntegerType> {
      private:
@@ -378,6 +614,129 @@ class FldlibBase : public DAffine::ExecutionPath {
          {  return inherited::constraint(source, function); }
    };
 
+   // A TPooledPointer shares a lazily created zonotope between the copies of a
+   //   TFldlibZonotopeOption like a std::shared_ptr, but without separate control block
+   //   nor atomic counter: the reference counter is stored in the node of the element.
+   // With FLOAT_POOL_ALLOCATION, the released nodes are kept in a free list for each
+   //   element type and they are reused by the next allocations. As for the NodePool, the
+   //   free list has no destructor and it is local to each thread with
+   //   FLOAT_THREAD_LOCAL_STATE, hence a node should be freed by the thread that has
+   //   allocated it.
+   template <class TypeElement>
+   class TPooledPointer {
+     public:
+      struct Statistics {
+         size_t systemAllocations; // nodes obtained from the global allocator
+         size_t reusedAllocations; // nodes obtained from the free list
+         size_t liveNodes;
+         size_t freeNodes;
+      };
+
+     private:
+      struct Node {
+         TypeElement element;
+         int references;
+
+         template <typename... Arguments> Node(Arguments&&... arguments)
+            :  element(std::forward<Arguments>(arguments)...), references(1) {}
+      };
+      struct Pool {
+         void* freeNodes; // linked through their first word
+         Statistics statistics;
+      };
+      static Pool& pool()
+         {  static FLOAT_THREAD_LOCAL Pool result;
+            return result;
+         }
+      static void* allocateNode()
+         {  Pool& nodePool = pool();
+            ++nodePool.statistics.liveNodes;
+#ifdef FLOAT_POOL_ALLOCATION
+            if (void* result = nodePool.freeNodes) {
+               nodePool.freeNodes = *(void**) result;
+               --nodePool.statistics.freeNodes;
+               ++nodePool.statistics.reusedAllocations;
+               return result;
+            }
+#endif
+            ++nodePool.statistics.systemAllocations;
+            return ::operator new(sizeof(Node));
+         }
+      static void freeNode(void* node)
+         {  Pool& nodePool = pool();
+            --nodePool.statistics.liveNodes;
+#ifdef FLOAT_POOL_ALLOCATION
+            *(void**) node = nodePool.freeNodes;
+            nodePool.freeNodes = node;
+            ++nodePool.statistics.freeNodes;
+#else
+            ::operator delete(node);
+#endif
+         }
+
+      Node* pnNode = nullptr;
+
+      explicit TPooledPointer(Node* node) : pnNode(node) {}
+
+     public:
+      TPooledPointer() = default;
+      TPooledPointer(const TPooledPointer& source) : pnNode(source.pnNode)
+         {  if (pnNode) ++pnNode->references; }
+      TPooledPointer(TPooledPointer&& source) : pnNode(source.pnNode) { source.pnNode = nullptr; }
+      ~TPooledPointer() { reset(); }
+      TPooledPointer& operator=(const TPooledPointer& source)
+         {  if (source.pnNode)
+               ++source.pnNode->references;
+            reset();
+            pnNode = source.pnNode;
+            return *this;
+         }
+      TPooledPointer& operator=(TPooledPointer&& source)
+         {  if (this != &source) {
+               reset();
+               pnNode = source.pnNode;
+               source.pnNode = nullptr;
+            }
+            return *this;
+         }
+
+      template <typename... Arguments> static TPooledPointer create(Arguments&&... arguments)
+         {  void* node = allocateNode();
+            try {
+               return TPooledPointer(new (node) Node(std::forward<Arguments>(arguments)...));
+            }
+            catch (...) {
+               freeNode(node);
+               throw;
+            }
+         }
+      void reset()
+         {  Node* node = pnNode;
+            pnNode = nullptr;
+            if (node && --node->references == 0) {
+               node->~Node();
+               freeNode(node);
+            }
+         }
+
+      TypeElement* get() const { return pnNode ? &pnNode->element : nullptr; }
+      TypeElement* operator->() const { return &pnNode->element; }
+      TypeElement& operator*() const { return pnNode->element; }
+      explicit operator bool() const { return pnNode != nullptr; }
+      int use_count() const { return pnNode ? pnNode->references : 0; }
+
+      static const Statistics& queryStatistics() { return pool().statistics; }
+      // gives back the free nodes to the global allocator
+      static void reclaim()
+         {  Pool& nodePool = pool();
+            while (void* node = nodePool.freeNodes) {
+               nodePool.freeNodes = *(void**) node;
+               ::operator delete(node);
+            }
+            nodePool.statistics.freeNodes = 0;
+         }
+   };
+
    enum BasicComparisonResult { BCRLess, BCREqual, BCRGreater, BCREnd };
    enum FullComparisonResult
       {  FCRUndefined = 0x0,
@@ -386,7 +745,7 @@ class FldlibBase : public DAffine::ExecutionPath {
          FCRGreaterOrEqual = FCRGreater | FCREqual, FCRAll = ~(~0 << BCREnd)
       };
 
-   static MergedExecutionPath mergedExecutionPath;
+   static FLOAT_THREAD_LOCAL MergedExecutionPath mergedExecutionPath;
 
    class MergeBranches : public DoubleZonotope::MergeBranches {
      private:
@@ -546,8 +905,9 @@ class FldlibBase::TFloatZonotope<long double> : public LongDoubleZonotope {
 template <typename DoubleType> requires std::floating_point<DoubleType>
 class TFldlibZonotopeOption : public FldlibBase {
   public:
+   typedef TPooledPointer<TFloatZonotope<DoubleType>> ZonotopePointer;
    DoubleType value;
-   std::shared_ptr<TFloatZonotope<DoubleType>> zonotope;
+   ZonotopePointer zonotope;
    typedef typename TFloatZonotope<DoubleType>::BuiltDouble BuiltDouble;
    typedef typename TFloatZonotope<DoubleType>::BuiltReal BuiltReal;
    typedef typename TFloatZonotope<DoubleType>::Equation Equation;
@@ -559,7 +919,7 @@ class TFldlibZonotopeOption : public FldlibBase {
    void normalize()
       {  if (active) {
             if (!zonotope.get())
-               zonotope = std::make_shared<TFloatZonotope<DoubleType>>(value);
+               zonotope = ZonotopePointer::create(value);
          }
          else
             zonotope.reset();
@@ -567,13 +927,19 @@ class TFldlibZonotopeOption : public FldlibBase {
    void normalizeForChange()
       {  if (active) {
             if (!zonotope.get())
-               zonotope = std::make_shared<TFloatZonotope<DoubleType>>(value);
+               zonotope = ZonotopePointer::create(value);
             else if (zonotope.use_count() != 1)
-               zonotope = std::make_shared<TFloatZonotope<DoubleType>>(*zonotope);
+               zonotope = ZonotopePointer::create(*zonotope);
          }
          else
             zonotope.reset();
       }
+   // copy on write of a shared zonotope before an update in place
+   TFloatZonotope<DoubleType>* unsharedZonotope()
+      {  if (zonotope && zonotope.use_count() != 1)
+            zonotope = ZonotopePointer::create(*zonotope);
+         return zonotope.get();
+      }
    template <typename T> requires std::floating_point<T> friend class TFldlibZonotopeOption;
 
   public:
@@ -583,17 +949,17 @@ class TFldlibZonotopeOption : public FldlibBase {
    template<typename T> TFldlibZonotopeOption(T source) requires std::integral<T>
       :  value(source) { normalize(); }
    TFldlibZonotopeOption(DoubleType min, DoubleType max)
-      :  value((min+max)/2.0), zonotope(new TFloatZonotope<DoubleType>(min, max))
+      :  value((min+max)/2.0), zonotope(ZonotopePointer::create(min, max))
       {  normalize(); }
    typedef TFloatZonotope<DoubleType>::ValueFromString ValueFromString;
    TFldlibZonotopeOption(const char* valueString, ValueFromString traits)
       {  std::istringstream out(valueString);
          out >> value;
          if (active)
-            zonotope = std::make_shared<TFloatZonotope<DoubleType>>(valueString, traits);
+            zonotope = ZonotopePointer::create(valueString, traits);
       }
    TFldlibZonotopeOption(DoubleType min, DoubleType max, DoubleType minErr, DoubleType maxErr)
-      :  value((min+max)/2.0), zonotope(new TFloatZonotope<DoubleType>(min, max, minErr, maxErr))
+      :  value((min+max)/2.0), zonotope(ZonotopePointer::create(min, max, minErr, maxErr))
       {  normalize(); }
    TFldlibZonotopeOption(const thisType& source) = default;
    TFldlibZonotopeOption(thisType&& source) = default;
@@ -601,18 +967,20 @@ class TFldlibZonotopeOption : public FldlibBase {
       :  value(source.value)
       {  if (active) {
             if (!source.zonotope.get())
-               zonotope = std::make_shared<TFloatZonotope<DoubleType>>(value);
+               zonotope = ZonotopePointer::create(value);
             else
-               zonotope = std::make_shared<TFloatZonotope<DoubleType>>(*source.zonotope);
+               zonotope = ZonotopePointer::create(*source.zonotope);
          }
       }
    template<typename T> TFldlibZonotopeOption(TFldlibZonotopeOption<T>&& source) requires std::floating_point<T>
       :  value(source.value)
       {  if (active) {
             if (!source.zonotope.get())
-               zonotope = std::make_shared<TFloatZonotope<DoubleType>>(value);
+               zonotope = ZonotopePointer::create(value);
+            else if (source.zonotope.use_count() != 1) // the other copies keep their zonotope
+               zonotope = ZonotopePointer::create(*source.zonotope);
             else
-               zonotope = std::make_shared<TFloatZonotope<DoubleType>>(std::move(*source.zonotope));
+               zonotope = ZonotopePointer::create(std::move(*source.zonotope));
          }
       }
 
@@ -636,7 +1004,7 @@ class TFldlibZonotopeOption : public FldlibBase {
          zonotope.reset();
          if (active) {
             if (source.zonotope.get())
-               zonotope = std::make_shared<TFloatZonotope<DoubleType>>(*source.zonotope);
+               zonotope = ZonotopePointer::create(*source.zonotope);
             else
                normalize();
          }
@@ -648,7 +1016,7 @@ class TFldlibZonotopeOption : public FldlibBase {
          zonotope.reset();
          if (active) {
             if (source.zonotope.get())
-               zonotope = std::make_shared<TFloatZonotope<DoubleType>>(*source.zonotope);
+               zonotope = ZonotopePointer::create(*source.zonotope);
             else
                normalize();
          }
@@ -3385,13 +3753,15 @@ class TFldlibZonotopeOption : public FldlibBase {
 
    void mergeWith(const thisType& source)
       {  if (!zonotope)
-            zonotope = std::make_shared<TFloatZonotope<DoubleType>>(value);
+            zonotope = ZonotopePointer::create(value);
+         else
+            unsharedZonotope();
          if (source.zonotope)
             zonotope->mergeWith(*source.zonotope);
          else
             zonotope->mergeWith(TFloatZonotope<DoubleType>(value));
       }
-   bool optimizeValue() { return zonotope ? zonotope->optimizeValue() : true; }
+   bool optimizeValue() { return zonotope ? unsharedZonotope()->optimizeValue() : true; }
    typedef typename TFloatZonotope<DoubleType>::EquationHolder EquationHolder;
    struct EquationOption {
       EquationHolder* equation;
@@ -3399,12 +3769,12 @@ class TFldlibZonotopeOption : public FldlibBase {
       void setHolder(PathExplorer* holder) { if (equation) equation->setHolder(holder); }
    };
    EquationOption getSRealDomain()
-      {  return EquationOption { zonotope ? &zonotope->getSRealDomain() : nullptr }; }
+      {  return EquationOption { zonotope ? &unsharedZonotope()->getSRealDomain() : nullptr }; }
    EquationOption getSError()
-      {  return EquationOption { zonotope ? &zonotope->getSError() : nullptr }; }
+      {  return EquationOption { zonotope ? &unsharedZonotope()->getSError() : nullptr }; }
    void addHighLevelUpdateError(DAffine::THighLevelUpdateVector<Equation>& highLevelUpdates,
          const BuiltReal& highLevelError)
-      {  if (zonotope) zonotope->addHighLevelUpdateError(highLevelUpdates, highLevelError); }
+      {  if (zonotope) unsharedZonotope()->addHighLevelUpdateError(highLevelUpdates, highLevelError); }
    void updateLocalState() { if (zonotope) zonotope->updateLocalState(); }
    static void writeImplementationHeader(STG::IOObject::OSBase& outFile)
       {  TFloatZonotope<DoubleType>::writeImplementationHeader(outFile); }
@@ -3419,7 +3789,7 @@ class TFldlibZonotopeOption : public FldlibBase {
          typename Equation::WriteParameters& equationWriteParameters,
          SymbolsManager& symbolsManager, BuiltReal& highLevelError)
       {  if (zonotope)
-            zonotope->readImplementationSynchronizationFromFile(inFile, readParameters,
+            unsharedZonotope()->readImplementationSynchronizationFromFile(inFile, readParameters,
                   equationReadParameters, outFile, writeParameters, equationWriteParameters,
                   symbolsManager, highLevelError);
       }
@@ -3436,7 +3806,7 @@ class TFldlibZonotopeOption : public FldlibBase {
          typename Equation::WriteParameters& equationWriteParameters,
          SymbolsManager& symbolsManager, BuiltReal& highLevelError)
       {  if (zonotope)
-            zonotope->readRealSynchronizationFromFile(inFile, equationReadParameters, outFile,
+            unsharedZonotope()->readRealSynchronizationFromFile(inFile, equationReadParameters, outFile,
                   equationWriteParameters, symbolsManager, highLevelError);
       }
    void writeRealSynchronizationToFile(STG::IOObject::OSBase& outFile,
@@ -3453,7 +3823,7 @@ class TFldlibZonotopeOption : public FldlibBase {
          if (hasZonotope) {
             AssumeCondition(hasZonotope == 2)
             if (!zonotope)
-               zonotope.reset(new TFloatZonotope<DoubleType>());
+               zonotope = ZonotopePointer::create();
             else {
                int numberOfBounds = codeArray.first();
                codeArray.removeAt(0);
@@ -3464,7 +3834,7 @@ class TFldlibZonotopeOption : public FldlibBase {
             codeArray.insertAtEnd(2); // 2 codes
             codeArray.insertAtEnd(2); // 2 bounds for the implementation
             codeArray.insertAtEnd(1); // 1 equation for the real
-            zonotope->readImplementationSynchronizationFromMemory(implementationArray,
+            unsharedZonotope()->readImplementationSynchronizationFromMemory(implementationArray,
                   equationArray, codeArray, symbolsManager, highLevelError);
          }
          else {
@@ -3493,7 +3863,7 @@ class TFldlibZonotopeOption : public FldlibBase {
          if (hasZonotope) {
             AssumeCondition(hasZonotope == 1)
             if (!zonotope)
-               zonotope.reset(new TFloatZonotope<DoubleType>());
+               zonotope = ZonotopePointer::create();
             else {
                int numberOfEquations = codeArray.first();
                codeArray.removeAt(0);
@@ -3501,7 +3871,7 @@ class TFldlibZonotopeOption : public FldlibBase {
             }
             codeArray.insertAtEnd(1); // 1 code
             codeArray.insertAtEnd(1); // 1 equation for the real
-            zonotope->readRealSynchronizationFromMemory(equationArray, codeArray,
+            unsharedZonotope()->readRealSynchronizationFromMemory(equationArray, codeArray,
                   symbolsManager, highLevelError);
          }
          else {
@@ -3559,7 +3929,8 @@ class TFldlibZonotopeOption : public FldlibBase {
          }
       }
    typedef thisType InstrumentedAffineType;
-   void cloneShareParts() {  normalizeForChange(); }
+   // the zonotope shared with the saved copy is copied on write by the updates in place
+   void cloneShareParts() {}
 };
 
 template <typename IntegerType> requires std::integral<IntegerType>
@@ -3641,7 +4012,11 @@ class TFldlibIntegerBranchOption : public FldlibBase {
             ? new TIntegerWithBranches<IntegerType>(source.cconditionalValue()) : nullptr);
          return *this;
       }
-   void conditionalAssigns(const std::vector<std::pair<int, bool>>& path, const thisType& source);
+   void conditionalAssigns(const BranchPath& path, const thisType& source);
+   void reduce()
+      {  if (conditionalValue)
+            TValueWithBranches<IntegerType>::reduce(value, conditionalValue);
+      }
 
    IntegerType getMaxValue() const
       {  IntegerType result = std::numeric_limits<IntegerType>::min();
@@ -4078,7 +4453,11 @@ class TFldlibBaseFloatingBranchOption : public FldlibBase {
             ? new TFloatingWithBranches<FloatingType>(source.cconditionalValue()) : nullptr);
          return *this;
       }
-   void conditionalAssigns(const std::vector<std::pair<int, bool>>& path, const thisType& source);
+   void conditionalAssigns(const BranchPath& path, const thisType& source);
+   void reduce()
+      {  if (conditionalValue)
+            TValueWithBranches<FloatingType>::reduce(value, conditionalValue);
+      }
 
    thisType& operator++()
       {  ++value;
@@ -4594,11 +4973,8 @@ class TFLDLibVectorBranchOption {
       {  if (!index.conditionalValue)
             return vibContent[index.value];
 
-         T result;
-         TFldlibIntegerBranchOption<int>::BranchCursor indexCursor(index);
-         while (indexCursor.setToNext())
-            result.conditionalAssigns(indexCursor.getPathAt(), vibContent[indexCursor.elementAt()]);
-         return result;
+         return FldlibBase::selectAt<T>(index.value, index.conditionalValue,
+               [this](int element) -> const T& { return vibContent[element]; });
       }
    class ElementProperty {
       std::vector<T>& vibContent;
@@ -4615,11 +4991,8 @@ class TFLDLibVectorBranchOption {
          {  if (!uIndex.conditionalValue)
                return vibContent[uIndex.value];
 
-            T result;
-            TFldlibIntegerBranchOption<int>::BranchCursor indexCursor(uIndex);
-            while (indexCursor.setToNext())
-               result.conditionalAssigns(indexCursor.getPathAt(), vibContent[indexCursor.elementAt()]);
-            return result;
+            return FldlibBase::selectAt<T>(uIndex.value, uIndex.conditionalValue,
+                  [this](int element) -> const T& { return vibContent[element]; });
          }
       ElementProperty& operator=(const T& value)
          {  if (!uIndex.conditionalValue)
@@ -4658,13 +5031,13 @@ class TFLDLibVectorBranchOption {
       }
    void pop_back()
       {  --ibSizes; }
-   void conditional_push_back(const std::vector<std::pair<int, bool>>& path,
+   void conditional_push_back(const FldlibBase::BranchPath& path,
          const T& value)
       {  vibContent.push_back(value);
          if (ibSizes.conditionalValue.get()) {
             TFldlibIntegerBranchOption<int>::BranchCursor sizeCursor(ibSizes);
             while (sizeCursor.setToNext()) {
-               std::vector<std::pair<int, bool>> newPath(path);
+               FldlibBase::BranchPath newPath(path);
                if (FldlibBase::mergePath(newPath, sizeCursor.getPathAt()))
                   vibContent[sizeCursor.elementAt()].conditionalAssigns(newPath, value);
             }
@@ -5024,21 +5397,17 @@ class TReferenceContainer<T> {
       {  if (!index.conditionalValue)
             return cContent[index.value];
 
-         TFldlibIntegerBranchOption<typename T::value_type> result;
-         TFldlibIntegerBranchOption<int>::BranchCursor indexCursor(index);
-         while (indexCursor.setToNext())
-            result.conditionalAssigns(indexCursor.getPathAt(), cContent[indexCursor.elementAt()]);
-         return result;
+         return FldlibBase::selectAt<TFldlibIntegerBranchOption<typename T::value_type>>(
+               index.value, index.conditionalValue,
+               [this](auto element) { return cContent[element]; });
       }
    TFldlibIntegerBranchOption<typename T::value_type> operator[](const TFldlibIntegerBranchOption<unsigned>& index) const
       {  if (!index.conditionalValue)
             return cContent[index.value];
 
-         TFldlibIntegerBranchOption<typename T::value_type> result;
-         TFldlibIntegerBranchOption<int>::BranchCursor indexCursor(index);
-         while (indexCursor.setToNext())
-            result.conditionalAssigns(indexCursor.getPathAt(), cContent[indexCursor.elementAt()]);
-         return result;
+         return FldlibBase::selectAt<TFldlibIntegerBranchOption<typename T::value_type>>(
+               index.value, index.conditionalValue,
+               [this](auto element) { return cContent[element]; });
       }
    const TFldlibIntegerBranchOption<typename T::value_type>& at(int index) const { return cContent(index); }
    TFldlibIntegerBranchOption<typename T::value_type> at(const TFldlibIntegerBranchOption<int>& index) const
@@ -5058,80 +5427,58 @@ class TIndexedReferenceContainer<T> {
   public:
    TIndexedReferenceContainer(const T& content, const TFldlibIntegerBranchOption<int>& index)
       :  cContent(content), uIndex(index) {}
-   const TFldlibIntegerBranchOption<typename T::value_type::value_type>& operator[](int index) const
+   TFldlibIntegerBranchOption<typename T::value_type::value_type> operator[](int index) const
       {  if (!uIndex.conditionalValue)
             return cContent[uIndex.value][index];
 
-         TFldlibIntegerBranchOption<typename T::value_type::value_type> result;
-         TFldlibIntegerBranchOption<int>::BranchCursor indexCursor(uIndex);
-         while (indexCursor.setToNext())
-            result.conditionalAssigns(indexCursor.getPathAt(), cContent[indexCursor.elementAt()][index]);
-         return result;
+         return FldlibBase::selectAt<TFldlibIntegerBranchOption<typename T::value_type::value_type>>(
+               uIndex.value, uIndex.conditionalValue,
+               [this, index](int element) { return cContent[element][index]; });
       }
-   const TFldlibIntegerBranchOption<typename T::value_type::value_type>& operator[](unsigned index) const
+   TFldlibIntegerBranchOption<typename T::value_type::value_type> operator[](unsigned index) const
       {  if (!uIndex.conditionalValue)
             return cContent[uIndex.value][index];
 
-         TFldlibIntegerBranchOption<typename T::value_type::value_type> result;
-         TFldlibIntegerBranchOption<int>::BranchCursor indexCursor(uIndex);
-         while (indexCursor.setToNext())
-            result.conditionalAssigns(indexCursor.getPathAt(), cContent[indexCursor.elementAt()][index]);
-         return result;
+         return FldlibBase::selectAt<TFldlibIntegerBranchOption<typename T::value_type::value_type>>(
+               uIndex.value, uIndex.conditionalValue,
+               [this, index](int element) { return cContent[element][index]; });
       }
    TFldlibIntegerBranchOption<typename T::value_type::value_type> operator[](const TFldlibIntegerBranchOption<int>& index) const
       {  if (!index.conditionalValue) {
             if (!uIndex.conditionalValue)
                return cContent[uIndex.value][index.value];
-            TFldlibIntegerBranchOption<typename T::value_type::value_type> result;
-            TFldlibIntegerBranchOption<int>::BranchCursor indexCursor(uIndex);
-            while (indexCursor.setToNext())
-               result.conditionalAssigns(indexCursor.getPathAt(), cContent[indexCursor.elementAt()][index]);
-            return result;
+            return FldlibBase::selectAt<TFldlibIntegerBranchOption<typename T::value_type::value_type>>(
+                  uIndex.value, uIndex.conditionalValue,
+                  [this, &index](int element) { return cContent[element][index.value]; });
          }
 
-         TFldlibIntegerBranchOption<typename T::value_type::value_type> result;
-         TFldlibIntegerBranchOption<int>::BranchCursor indexCursor(uIndex);
-         while (indexCursor.setToNext()) {
-            TFldlibIntegerBranchOption<int>::BranchCursor secondIndexCursor(index);
-            while (secondIndexCursor.setToNext()) {
-               std::vector<std::pair<int, bool>> path = indexCursor.getPathAt();
-               path.insert(path.end(), secondIndexCursor.getPathAt().begin(),
-                     secondIndexCursor.getPathAt().end());
-               result.conditionalAssigns(path,
-                  cContent[indexCursor.elementAt()][secondIndexCursor.elementAt()]);
-            }
-         }
-         return result;
+         typedef TFldlibIntegerBranchOption<typename T::value_type::value_type> ResultType;
+         return FldlibBase::selectAt<ResultType>(uIndex.value, uIndex.conditionalValue,
+               [this, &index](int element)
+               {  return FldlibBase::selectAt<ResultType>(index.value, index.conditionalValue,
+                     [this, element](auto secondElement) { return cContent[element][secondElement]; });
+               });
       }
    TFldlibIntegerBranchOption<typename T::value_type::value_type> operator[](const TFldlibIntegerBranchOption<unsigned>& index) const
       {  if (!index.conditionalValue) {
             if (!uIndex.conditionalValue)
                return cContent[uIndex.value][index.value];
-            TFldlibIntegerBranchOption<typename T::value_type::value_type> result;
-            TFldlibIntegerBranchOption<int>::BranchCursor indexCursor(uIndex);
-            while (indexCursor.setToNext())
-               result.conditionalAssigns(indexCursor.getPathAt(), cContent[indexCursor.elementAt()][index]);
-            return result;
+            return FldlibBase::selectAt<TFldlibIntegerBranchOption<typename T::value_type::value_type>>(
+                  uIndex.value, uIndex.conditionalValue,
+                  [this, &index](int element) { return cContent[element][index.value]; });
          }
 
-         TFldlibIntegerBranchOption<typename T::value_type::value_type> result;
-         TFldlibIntegerBranchOption<int>::BranchCursor indexCursor(uIndex);
-         while (indexCursor.setToNext()) {
-            TFldlibIntegerBranchOption<int>::BranchCursor secondIndexCursor(index);
-            while (secondIndexCursor.setToNext()) {
-               std::vector<std::pair<int, bool>> path = indexCursor.getPathAt();
-               path.insert(path.end(), secondIndexCursor.getPathAt().begin(),
-                     secondIndexCursor.getPathAt().end());
-               result.conditionalAssigns(path,
-                  cContent[indexCursor.elementAt()][secondIndexCursor.elementAt()]);
-            }
-         }
-         return result;
+         typedef TFldlibIntegerBranchOption<typename T::value_type::value_type> ResultType;
+         return FldlibBase::selectAt<ResultType>(uIndex.value, uIndex.conditionalValue,
+               [this, &index](int element)
+               {  return FldlibBase::selectAt<ResultType>(index.value, index.conditionalValue,
+                     [this, element](auto secondElement) { return cContent[element][secondElement]; });
+               });
       }
-   const TFldlibIntegerBranchOption<typename T::value_type::value_type>& at(int index) const { return operator[](index); }
+   TFldlibIntegerBranchOption<typename T::value_type::value_type> at(int index) const { return operator[](index); }
    TFldlibIntegerBranchOption<typename T::value_type::value_type> at(const TFldlibIntegerBranchOption<int>& index) const
       {  return operator[](index); }
-   const TFldlibIntegerBranchOption<typename T::value_type::value_type>& at(unsigned index) const { return operator[](index); }
+   TFldlibIntegerBranchOption<typename T::value_type::value_type> at(unsigned index) const { return operator[](index); }
    TFldlibIntegerBranchOption<typename T::value_type::value_type> at(const TFldlibIntegerBranchOption<unsigned>& index) const
       {  return operator[](index); }
 };
@@ -5173,11 +5520,9 @@ class TReferenceContainer<T> {
       {  if (!index.conditionalValue)
             return cContent[index.value];
 
-         TFldlibFloatingBranchOption<typename T::value_type> result;
-         TFldlibIntegerBranchOption<int>::BranchCursor indexCursor(index);
-         while (indexCursor.setToNext())
-            result.conditionalAssigns(indexCursor.getPathAt(), cContent[indexCursor.elementAt()]);
-         return result;
+         return FldlibBase::selectAt<TFldlibFloatingBranchOption<typename T::value_type>>(
+               index.value, index.conditionalValue,
+               [this](auto element) { return cContent[element]; });
       }
    const TFldlibFloatingBranchOption<typename T::value_type>& at(int index) const { return cContent(index); }
    TFldlibFloatingBranchOption<typename T::value_type> at(const TFldlibIntegerBranchOption<int>& index) const
@@ -5187,11 +5532,9 @@ class TReferenceContainer<T> {
       {  if (!index.conditionalValue)
             return cContent[index.value];
 
-         TFldlibFloatingBranchOption<typename T::value_type> result;
-         TFldlibIntegerBranchOption<int>::BranchCursor indexCursor(index);
-         while (indexCursor.setToNext())
-            result.conditionalAssigns(indexCursor.getPathAt(), cContent[indexCursor.elementAt()]);
-         return result;
+         return FldlibBase::selectAt<TFldlibFloatingBranchOption<typename T::value_type>>(
+               index.value, index.conditionalValue,
+               [this](auto element) { return cContent[element]; });
       }
    const TFldlibFloatingBranchOption<typename T::value_type>& at(unsigned index) const { return cContent(index); }
    TFldlibFloatingBranchOption<typename T::value_type> at(const TFldlibIntegerBranchOption<unsigned>& index) const
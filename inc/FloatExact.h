@@ -280,6 +280,10 @@ class TInstrumentedFloat
    TInstrumentedFloat(const thisType& source) = default;
    TInstrumentedFloat& operator=(const thisType& source) = default;
 
+   // the exact values do not depend on the state of a thread
+   typedef thisType ThreadExchange;
+   const thisType& exportToThread() const { return *this; }
+
    template <class TypeBuiltArgument, typename TypeImplementationArgument>
    TInstrumentedFloat(const TInstrumentedFloat<TypeBuiltArgument, TypeImplementationArgument>& source)
       :  inherited(source) {}
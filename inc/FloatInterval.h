@@ -385,14 +385,19 @@ class TInstrumentedFloatInterval : public TFloatInterval<BaseFloatInterval, Type
    TInstrumentedFloatInterval(thisType&& source) = default; // [TODO] keep symbolic for constraints
    TInstrumentedFloatInterval& operator=(const thisType& source) = default;
    TInstrumentedFloatInterval& operator=(thisType&& source) = default; // [TODO] keep symbolic for constraints
+
+   // the intervals do not depend on the state of a thread
+   typedef thisType ThreadExchange;
+   const thisType& exportToThread() const { return *this; }
    template <class TypeBuiltArgument, typename TypeImplementationArgument>
    thisType& operator=(const TInstrumentedFloatInterval<TypeBuiltArgument, TypeImplementationArgument>& source)
       {  return (thisType&) inherited::operator=(source); }
    template<typename T> thisType& operator=(T source) requires std::floating_point<T> or std::integral<T>
       {  return (thisType&) inherited::operator=(thisType(source)); }
 
-   const TypeBuiltDouble& min() const { return inherited::min(); }
-   const TypeBuiltDouble& max() const { return inherited::max(); }
+   // native bounds are returned by value
+   decltype(auto) min() const { return inherited::min(); }
+   decltype(auto) max() const { return inherited::max(); }
 
    thisType operator++() { return (thisType&) inherited::operator+=(thisType(1)); }
    thisType operator++(int) { thisType result = *this; inherited::operator+=(thisType(1)); return result; }
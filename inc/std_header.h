@@ -13,6 +13,10 @@
 #define DECLARE_RESOURCES 
 #define INIT_MAIN 
 #define END_MAIN 
+#define INIT_THREAD 
+#define FLOAT_THREAD_EXPORT(x) (x)
+#define FTHREAD_VALUE float
+#define DTHREAD_VALUE double
 
 #define FLOAT_IMPLEMENTATION 
 
@@ -27,6 +31,11 @@
 #include <float.h>
 #include <iostream> // for std::cout
 
+#include "fldlib_config.h"
+#ifdef FLOAT_THREAD_LOCAL_STATE
+#include <thread> // for the threads of the analyzed program
+#endif
+
 #include <math.h>
 #include "float_diagnosis.h"
 
@@ -35,6 +44,13 @@
 #define STRINGIFY(x) #x
 #define TOSTRING(x) STRINGIFY(x)
 
+/* with FLOAT_THREAD_LOCAL_STATE, INIT_THREAD starts the body of a thread of the
+   analyzed program and the values cross the threads with FLOAT_THREAD_EXPORT */
+#define INIT_THREAD double::ThreadInitialization _threadInitialization;
+#define FLOAT_THREAD_EXPORT(x) (x).exportToThread()
+#define FTHREAD_VALUE float::ThreadExchange
+#define DTHREAD_VALUE double::ThreadExchange
+
 #ifdef FLOAT_THRESHOLD_DETECTION
 #define FLOAT_INIT_THRESHOLD init.setSupportThreshold();
 #else
@@ -100,6 +116,24 @@
 #define FLOAT_INIT_PURE_ZONOTOPE 
 #endif
 
+#ifdef FLOAT_BINARY_TRACE
+#define FLOAT_INIT_BINARY_TRACE init.setSupportBinaryTrace();
+#else
+#define FLOAT_INIT_BINARY_TRACE 
+#endif
+
+#ifdef FLOAT_FORK_PATHS
+#define FLOAT_INIT_FORK_PATHS init.setSupportForkPaths();
+#else
+#define FLOAT_INIT_FORK_PATHS 
+#endif
+
+#ifdef FLOAT_SYMBOLS_STATISTICS
+#define FLOAT_INIT_SYMBOLS_STATISTICS init.setSupportSymbolsStatistics();
+#else
+#define FLOAT_INIT_SYMBOLS_STATISTICS 
+#endif
+
 #ifdef FLOAT_TRACK
 #define FLOAT_INIT_TRACK init.setTrackErrorOrigin();
 #else
@@ -112,12 +146,39 @@
 #define FLOAT_INIT_LIMIT_NOISE_SYMBOLS_NUMBER 
 #endif
 
+#ifdef FLOAT_NOISE_SYMBOLS_BUDGET
+#define FLOAT_INIT_NOISE_SYMBOLS_BUDGET init.setNoiseSymbolsBudget(FLOAT_NOISE_SYMBOLS_BUDGET);
+#else
+#define FLOAT_INIT_NOISE_SYMBOLS_BUDGET 
+#endif
+
+#ifdef FLOAT_NOISE_SYMBOLS_MEMORY_LIMIT
+#define FLOAT_INIT_NOISE_SYMBOLS_MEMORY_LIMIT init.setNoiseSymbolsMemoryLimit(FLOAT_NOISE_SYMBOLS_MEMORY_LIMIT);
+#else
+#define FLOAT_INIT_NOISE_SYMBOLS_MEMORY_LIMIT 
+#endif
+
+#ifdef FLOAT_TRANSCENDENTAL_CACHE_SIZE
+#define FLOAT_INIT_TRANSCENDENTAL_CACHE_SIZE init.setTranscendentalCacheSize(FLOAT_TRANSCENDENTAL_CACHE_SIZE);
+#else
+#define FLOAT_INIT_TRANSCENDENTAL_CACHE_SIZE 
+#endif
+
 #ifdef FLOAT_MAP_SYMBOLS
 #define FLOAT_INIT_MAP_SYMBOLS(filename) init.setSupportMapSymbols(filename);
 #else
 #define FLOAT_INIT_MAP_SYMBOLS(filename) 
 #endif
 
+#if defined(FLOAT_PARALLEL_PATHS) && !defined(FLOAT_SCENARIO) && !defined(FLOAT_INTERFACE)
+#define FLOAT_INIT_PARALLEL_PATHS init.setSupportParallelPaths(FLOAT_PARALLEL_PATHS);
+#define FLOAT_PARALLEL_SPLIT_ALL(ident)                                                          \
+   NumericalDomains::DAffine::ExecutionPath::setParallelRoot(_pathExplorer##ident, _mergeMemory##ident);
+#else
+#define FLOAT_INIT_PARALLEL_PATHS 
+#define FLOAT_PARALLEL_SPLIT_ALL(ident) 
+#endif
+
 #ifdef FLOAT_LOOP_UNSTABLE
 #define INIT_MAIN                                                                                \
   NumericalDomains::FloatZonotope::Initialization init;                                          \
@@ -128,15 +189,21 @@
   FLOAT_INIT_FIRST_FOLLOW_EXE                                                                    \
   FLOAT_INIT_SIMPLIFICATION                                                                      \
   FLOAT_INIT_LIMIT_NOISE_SYMBOLS_NUMBER                                                          \
+  FLOAT_INIT_NOISE_SYMBOLS_BUDGET                                                                \
+  FLOAT_INIT_NOISE_SYMBOLS_MEMORY_LIMIT                                                          \
+  FLOAT_INIT_TRANSCENDENTAL_CACHE_SIZE                                                           \
   FLOAT_INIT_PURE_ZONOTOPE                                                                       \
   FLOAT_INIT_BACKTRACE                                                                           \
   FLOAT_INIT_TRACK                                                                               \
   FLOAT_INIT_ACTIVE_OPTION                                                                       \
+  FLOAT_INIT_PARALLEL_PATHS                                                                      \
+  FLOAT_INIT_SYMBOLS_STATISTICS                                                                  \
   init.setResultFile(TOSTRING(PROG_NAME) "_diag_aff" FLOAT_PROG_SUFFIX);                         \
   FLOAT_INIT_MAP_SYMBOLS(TOSTRING(PROG_NAME) FLOAT_PROG_SUFFIX "_map")                           \
   std::cout << FLOAT_INIT_MESSAGE << std::endl;                                                  \
   try {                                                                                          \
-     FLOAT_SPLIT_ALL(main, double::end(), double::end())
+     FLOAT_SPLIT_ALL(main, double::end(), double::end())                                         \
+     FLOAT_PARALLEL_SPLIT_ALL(main)
 
 #define END_MAIN                                                                                 \
      FLOAT_MERGE_ALL(main, double::end(), double::end())                                         \
@@ -163,10 +230,16 @@
   FLOAT_INIT_FIRST_FOLLOW_EXE                                                                    \
   FLOAT_INIT_SIMPLIFICATION                                                                      \
   FLOAT_INIT_LIMIT_NOISE_SYMBOLS_NUMBER                                                          \
+  FLOAT_INIT_NOISE_SYMBOLS_BUDGET                                                                \
+  FLOAT_INIT_NOISE_SYMBOLS_MEMORY_LIMIT                                                          \
+  FLOAT_INIT_TRANSCENDENTAL_CACHE_SIZE                                                           \
   FLOAT_INIT_PURE_ZONOTOPE                                                                       \
   FLOAT_INIT_BACKTRACE                                                                           \
   FLOAT_INIT_TRACK                                                                               \
   FLOAT_INIT_ACTIVE_OPTION                                                                       \
+  FLOAT_INIT_BINARY_TRACE                                                                        \
+  FLOAT_INIT_FORK_PATHS                                                                          \
+  FLOAT_INIT_SYMBOLS_STATISTICS                                                                  \
   init.setResultFile(TOSTRING(PROG_NAME) "_diag_aff" FLOAT_PROG_SUFFIX);                         \
   FLOAT_INIT_MAP_SYMBOLS(TOSTRING(PROG_NAME) FLOAT_PROG_SUFFIX "_map")                           \
   std::cout << FLOAT_INIT_MESSAGE << std::endl;                                                  \
@@ -421,6 +494,10 @@ static inline double rand_of_double(double x, double y)
 #define DECLARE_RESOURCES 
 #define INIT_MAIN 
 #define END_MAIN 
+#define INIT_THREAD 
+#define FLOAT_THREAD_EXPORT(x) (x)
+#define FTHREAD_VALUE float
+#define DTHREAD_VALUE double
 
 #endif
 
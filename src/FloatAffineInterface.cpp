@@ -171,6 +171,21 @@ ExecutionPath::setSupportPureZonotope() {
    DAffine::ExecutionPath::setSupportPureZonotope();
 }
 
+void
+ExecutionPath::setSupportBinaryTrace() {
+   DAffine::ExecutionPath::setSupportBinaryTrace();
+}
+
+void
+ExecutionPath::setSupportForkPaths() {
+   DAffine::ExecutionPath::setSupportForkPaths();
+}
+
+void
+ExecutionPath::setSupportSymbolsStatistics() {
+   DAffine::ExecutionPath::setSupportSymbolsStatistics();
+}
+
 void
 ExecutionPath::setTrackErrorOrigin() {
    DAffine::ExecutionPath::setTrackErrorOrigin();
@@ -186,6 +201,21 @@ ExecutionPath::setLimitNoiseSymbolsNumber(int limit) {
    DAffine::ExecutionPath::setLimitNoiseSymbolsNumber(limit);
 }
 
+void
+ExecutionPath::setNoiseSymbolsBudget(int budget) {
+   DAffine::ExecutionPath::setNoiseSymbolsBudget(budget);
+}
+
+void
+ExecutionPath::setNoiseSymbolsMemoryLimit(int megabytes) {
+   DAffine::ExecutionPath::setNoiseSymbolsMemoryLimit(megabytes);
+}
+
+void
+ExecutionPath::setTranscendentalCacheSize(int size) {
+   DAffine::ExecutionPath::setTranscendentalCacheSize(size);
+}
+
 void
 ExecutionPath::setSimplificationTriggerPercent(double percent) {
    DAffine::ExecutionPath::setSimplificationTriggerPercent(percent);
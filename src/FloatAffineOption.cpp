@@ -33,9 +33,110 @@
 
 namespace NumericalDomains {
 
-bool FldlibBase::active = false;
-int FldlibBase::numberOfBranches = 0;
-int FldlibBase::splitBranchIdentifier = 0;
+FLOAT_THREAD_LOCAL bool FldlibBase::active = false;
+FLOAT_THREAD_LOCAL int FldlibBase::numberOfBranches = 0;
+FLOAT_THREAD_LOCAL int FldlibBase::splitBranchIdentifier = 0;
+
+FldlibBase::BranchPath::Step::Step(int mergeBranchIndexSource, bool directionSource,
+      const std::shared_ptr<const Step>& previousSource)
+   :  mergeBranchIndex(mergeBranchIndexSource), direction(directionSource),
+      length(previousSource.get() ? previousSource->length+1 : 1), previous(previousSource),
+      jump(nullptr) {
+   // skew-binary jumps: the jump of a step is the jump of the jump of its parent if both
+   //   jumps of the parent cover the same length, its parent otherwise
+   const Step* parent = previousSource.get();
+   if (parent) {
+      const Step* parentJump = parent->jump;
+      if (parentJump && parent->length - parentJump->length
+            == parentJump->length - (parentJump->jump ? parentJump->jump->length : 0))
+         jump = parentJump->jump;
+      else
+         jump = parent;
+   }
+}
+
+std::shared_ptr<const FldlibBase::BranchPath::Step>
+FldlibBase::BranchPath::intern(const std::shared_ptr<const Step>& previous, int mergeBranchIndex,
+      bool direction) {
+   InternTable& table = internTable();
+   StepKey key { previous.get(), mergeBranchIndex, direction };
+   auto found = table.steps.find(key);
+   if (found != table.steps.end()) {
+      std::shared_ptr<const Step> result = found->second.lock();
+      if (!result.get()) {
+         // the key of an expired step may be reused by a new previous step at the same address
+         result.reset(new Step(mergeBranchIndex, direction, previous));
+         found->second = result;
+      }
+      return result;
+   }
+   std::shared_ptr<const Step> result(new Step(mergeBranchIndex, direction, previous));
+   table.steps.insert(std::make_pair(key, std::weak_ptr<const Step>(result)));
+   if (table.steps.size() >= table.sweepThreshold) {
+      for (auto iter = table.steps.begin(); iter != table.steps.end(); ) {
+         if (iter->second.expired())
+            iter = table.steps.erase(iter);
+         else
+            ++iter;
+      }
+      table.sweepThreshold = std::max((size_t) 1024, 2*table.steps.size());
+   }
+   return result;
+}
+
+const FldlibBase::BranchPath::Step*
+FldlibBase::BranchPath::find(int mergeBranchIndex) const {
+   const Step* step = spLast.get();
+   while (step && step->mergeBranchIndex > mergeBranchIndex) {
+      if (step->jump && step->jump->mergeBranchIndex >= mergeBranchIndex)
+         step = step->jump;
+      else
+         step = step->previous.get();
+   }
+   return (step && step->mergeBranchIndex == mergeBranchIndex) ? step : nullptr;
+}
+
+bool
+FldlibBase::BranchPath::mergeWith(const BranchPath& source) {
+   if (!source.spLast.get() || spLast == source.spLast)
+      return true;
+   if (!spLast.get()) {
+      spLast = source.spLast;
+      return true;
+   }
+
+   std::vector<const Step*> newSteps; // by decreasing merge branch index
+   for (const Step* step = source.spLast.get(); step; step = step->previous.get()) {
+      const Step* found = find(step->mergeBranchIndex);
+      if (!found)
+         newSteps.push_back(step);
+      else if (found->direction != step->direction)
+         return false;
+   }
+   if (newSteps.empty())
+      return true;
+
+   // the prefix before the first new step is kept, the next steps are rebuilt
+   std::shared_ptr<const Step> oldLast = spLast;
+   std::vector<const Step*> suffix; // by decreasing merge branch index
+   int firstNewIndex = newSteps.back()->mergeBranchIndex;
+   while (spLast.get() && spLast->mergeBranchIndex > firstNewIndex) {
+      suffix.push_back(spLast.get());
+      pop_back();
+   }
+   auto suffixIter = suffix.rbegin();
+   auto newIter = newSteps.rbegin();
+   while (suffixIter != suffix.rend() || newIter != newSteps.rend()) {
+      const Step* step;
+      if (newIter == newSteps.rend() || (suffixIter != suffix.rend()
+               && (*suffixIter)->mergeBranchIndex < (*newIter)->mergeBranchIndex))
+         step = *suffixIter++;
+      else
+         step = *newIter++;
+      spLast = intern(spLast, step->mergeBranchIndex, step->direction);
+   }
+   return true;
+}
 
 template class TFldlibZonotopeOption<float>;
 template class TFldlibZonotopeOption<double>;
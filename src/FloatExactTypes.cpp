@@ -32,7 +32,7 @@
 
 namespace NumericalDomains { namespace DDoubleExact {
 
-Numerics::DDouble::Access::ReadParameters
+FLOAT_THREAD_LOCAL Numerics::DDouble::Access::ReadParameters
 BaseExecutionPath::rpNearestParams;
 
 }}
@@ -66,6 +66,15 @@ template class TCompareFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1,
 template class TCompareFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1,
          TBaseFloatInterval<ExecutionPath>, BuiltLongDouble, long double>;
 
+#ifdef FLOAT_NATIVE_INTERVAL
+template class TCompareHostFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1,
+         TBaseFloatInterval<ExecutionPath>, BuiltFloat, float>;
+template class TCompareHostFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1,
+         TBaseFloatInterval<ExecutionPath>, BuiltDouble, double>;
+template class TCompareHostFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1,
+         TBaseFloatInterval<ExecutionPath>, BuiltLongDouble, long double>;
+#endif
+
 template class TInstrumentedFloatInterval<BuiltFloat, float>;
 template class TInstrumentedFloatInterval<BuiltDouble, double>;
 template class TInstrumentedFloatInterval<BuiltLongDouble, long double>;
@@ -79,6 +88,14 @@ template void TBaseFloatInterval<ExecutionPath>::assumeInterval<TCompareFloatInt
 template void TBaseFloatInterval<ExecutionPath>::writeInterval<TCompareFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1, TBaseFloatInterval<ExecutionPath>, TBuiltFloat<LongDoubleFloatDigits::UBitSizeMantissa+1, 23, 8>, float> >(TCompareFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1, TBaseFloatInterval<ExecutionPath>, TBuiltFloat<LongDoubleFloatDigits::UBitSizeMantissa+1, 23, 8>, float> const&) const;
 template void TBaseFloatInterval<ExecutionPath>::writeInterval<TCompareFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1, TBaseFloatInterval<ExecutionPath>, TBuiltFloat<LongDoubleFloatDigits::UBitSizeMantissa+1, 52, 11>, double> >(TCompareFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1, TBaseFloatInterval<ExecutionPath>, TBuiltFloat<LongDoubleFloatDigits::UBitSizeMantissa+1, 52, 11>, double> const&) const;
 template void TBaseFloatInterval<ExecutionPath>::writeInterval<TCompareFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1, TBaseFloatInterval<ExecutionPath>, TBuiltFloat<LongDoubleFloatDigits::UBitSizeMantissa+1, FloatDigitsHelper::TFloatDigits<long double>::UBitSizeMantissa, FloatDigitsHelper::TFloatDigits<long double>::UBitSizeExponent>, long double> >(TCompareFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1, TBaseFloatInterval<ExecutionPath>, TBuiltFloat<LongDoubleFloatDigits::UBitSizeMantissa+1, FloatDigitsHelper::TFloatDigits<long double>::UBitSizeMantissa, FloatDigitsHelper::TFloatDigits<long double>::UBitSizeExponent>, long double> const&) const;
+#ifdef FLOAT_NATIVE_INTERVAL
+template void TBaseFloatInterval<ExecutionPath>::assumeInterval<TCompareHostFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1, TBaseFloatInterval<ExecutionPath>, BuiltFloat, float> >(TCompareHostFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1, TBaseFloatInterval<ExecutionPath>, BuiltFloat, float> const&) const;
+template void TBaseFloatInterval<ExecutionPath>::assumeInterval<TCompareHostFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1, TBaseFloatInterval<ExecutionPath>, BuiltDouble, double> >(TCompareHostFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1, TBaseFloatInterval<ExecutionPath>, BuiltDouble, double> const&) const;
+template void TBaseFloatInterval<ExecutionPath>::assumeInterval<TCompareHostFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1, TBaseFloatInterval<ExecutionPath>, BuiltLongDouble, long double> >(TCompareHostFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1, TBaseFloatInterval<ExecutionPath>, BuiltLongDouble, long double> const&) const;
+template void TBaseFloatInterval<ExecutionPath>::writeInterval<TCompareHostFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1, TBaseFloatInterval<ExecutionPath>, BuiltFloat, float> >(TCompareHostFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1, TBaseFloatInterval<ExecutionPath>, BuiltFloat, float> const&) const;
+template void TBaseFloatInterval<ExecutionPath>::writeInterval<TCompareHostFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1, TBaseFloatInterval<ExecutionPath>, BuiltDouble, double> >(TCompareHostFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1, TBaseFloatInterval<ExecutionPath>, BuiltDouble, double> const&) const;
+template void TBaseFloatInterval<ExecutionPath>::writeInterval<TCompareHostFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1, TBaseFloatInterval<ExecutionPath>, BuiltLongDouble, long double> >(TCompareHostFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1, TBaseFloatInterval<ExecutionPath>, BuiltLongDouble, long double> const&) const;
+#endif
 template void TBaseFloatInterval<ExecutionPath>::assumeInterval<TInstrumentedFloatInterval<BuiltFloat, float> >(TInstrumentedFloatInterval<BuiltFloat, float> const&) const;
 template void TBaseFloatInterval<ExecutionPath>::assumeInterval<TInstrumentedFloatInterval<BuiltDouble, double> >(TInstrumentedFloatInterval<BuiltDouble, double> const&) const;
 template void TBaseFloatInterval<ExecutionPath>::assumeInterval<TInstrumentedFloatInterval<BuiltLongDouble, long double> >(TInstrumentedFloatInterval<BuiltLongDouble, long double> const&) const;
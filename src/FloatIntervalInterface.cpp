@@ -48,6 +48,11 @@ typedef FloatDigitsHelper::TFloatDigits<long double> LongDoubleFloatDigits;
 template class TCompareFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1, TBaseFloatInterval<ExecutionPath>, BuiltFloat, float>;
 template class TCompareFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1, TBaseFloatInterval<ExecutionPath>, BuiltDouble, double>;
 template class TCompareFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1, TBaseFloatInterval<ExecutionPath>, BuiltLongDouble, long double>;
+#ifdef FLOAT_NATIVE_INTERVAL
+template class TCompareHostFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1, TBaseFloatInterval<ExecutionPath>, BuiltFloat, float>;
+template class TCompareHostFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1, TBaseFloatInterval<ExecutionPath>, BuiltDouble, double>;
+template class TCompareHostFloatInterval<LongDoubleFloatDigits::UBitSizeMantissa+1, TBaseFloatInterval<ExecutionPath>, BuiltLongDouble, long double>;
+#endif
 
 } // end of namespace DDoubleInterval
 
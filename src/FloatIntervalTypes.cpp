@@ -36,10 +36,10 @@
 
 namespace NumericalDomains { namespace DDoubleInterval {
 
-Numerics::DDouble::Access::ReadParameters
+FLOAT_THREAD_LOCAL Numerics::DDouble::Access::ReadParameters
 BaseExecutionPath::rpMinParams;
 
-Numerics::DDouble::Access::ReadParameters
+FLOAT_THREAD_LOCAL Numerics::DDouble::Access::ReadParameters
 BaseExecutionPath::rpMaxParams;
 
 }} // end of namespace NumericalDomains::DDoubleInterval
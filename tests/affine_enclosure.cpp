@@ -0,0 +1,145 @@
+/**************************************************************************/
+/*                                                                        */
+/*  Copyright (C) 2011-2025                                               */
+/*    CEA (Commissariat a l'Energie Atomique et aux Energies              */
+/*         Alternatives)                                                  */
+/*                                                                        */
+/*  you can redistribute it and/or modify it under the terms of the GNU   */
+/*  Lesser General Public License as published by the Free Software       */
+/*  Foundation, version 2.1.                                              */
+/*                                                                        */
+/*  It is distributed in the hope that it will be useful,                 */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         */
+/*  GNU Lesser General Public License for more details.                   */
+/*                                                                        */
+/*  See the GNU Lesser General Public License version 2.1                 */
+/*  for more details (enclosed in the file LICENSE).                      */
+/*                                                                        */
+/**************************************************************************/
+
+/////////////////////////////////
+//
+// Library   : NumericalDomains
+// Unit      : Affine relationships
+// File      : affine_enclosure.cpp
+// Description :
+//   Check that the bounds of an analysis with sound double coefficients
+//   enclose the bounds of the same analysis with the default coefficients,
+//   variable by variable.
+//   The arguments are the two output files, in this order.
+//
+
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <string>
+
+namespace {
+
+// hull of the bounds printed for a variable, over the iterations and the paths
+struct Bounds {
+   double min[3] = { HUGE_VAL, HUGE_VAL, HUGE_VAL };
+   double max[3] = { -HUGE_VAL, -HUGE_VAL, -HUGE_VAL }; // implementation, real, error
+   bool hasField[3] = { false, false, false };
+};
+
+const char* fieldPrefixes[3] = { "i=[", "r=[", "e=[" };
+
+double
+readValue(const std::string& text) {
+   if (text == "-oo" || text == "-inf")
+      return -HUGE_VAL;
+   if (text == "oo" || text == "+oo" || text == "inf" || text == "+inf")
+      return HUGE_VAL;
+   return strtod(text.c_str(), nullptr);
+}
+
+bool
+readBounds(const char* fileName, std::map<std::string, Bounds>& result) {
+   std::ifstream in(fileName);
+   if (!in) {
+      fprintf(stderr, "cannot open %s\n", fileName);
+      return false;
+   };
+   std::string line;
+   while (std::getline(in, line)) {
+      size_t nameEnd = line.find(":\t");
+      if (nameEnd == std::string::npos)
+         continue;
+      Bounds& bounds = result[line.substr(0, nameEnd)];
+      // the symbolic forms between braces follow the bounds
+      std::string interval = line.substr(nameEnd+2, line.find('{', nameEnd) - nameEnd - 2);
+      for (int field = 0; field < 3; ++field) {
+         size_t start = interval.find(fieldPrefixes[field]);
+         if (start == std::string::npos || (start > 0 && interval[start-1] != ' '))
+            continue;
+         start += 3;
+         size_t separator = interval.find(", ", start), end = interval.find(']', start);
+         if (separator == std::string::npos || end == std::string::npos || separator > end)
+            continue;
+         double min = readValue(interval.substr(start, separator - start));
+         double max = readValue(interval.substr(separator+2, end - separator - 2));
+         if (min < bounds.min[field])
+            bounds.min[field] = min;
+         if (max > bounds.max[field])
+            bounds.max[field] = max;
+         bounds.hasField[field] = true;
+      };
+   };
+   return true;
+}
+
+// The joins of the loops and the absorption of the noise symbols are not monotonic.
+// Hence the bounds of both modes may differ by some ulps of the double coefficients.
+const double DTolerance = 16*DBL_EPSILON;
+
+bool
+isEnclosed(const Bounds& defaultBounds, const Bounds& soundBounds, int field) {
+   double min = defaultBounds.min[field], max = defaultBounds.max[field];
+   if (std::isfinite(min))
+      min += DTolerance*fabs(min);
+   if (std::isfinite(max))
+      max -= DTolerance*fabs(max);
+   return soundBounds.min[field] <= min && max <= soundBounds.max[field];
+}
+
+} // end of namespace
+
+int
+main(int argc, char** argv) {
+   if (argc != 3) {
+      fprintf(stderr, "usage: %s default_out sound_out\n", argv[0]);
+      return 1;
+   };
+   // the wider sound bounds may explore more unstable paths than the default bounds
+   std::map<std::string, Bounds> defaultBounds, soundBounds;
+   if (!readBounds(argv[1], defaultBounds) || !readBounds(argv[2], soundBounds))
+      return 1;
+   int errors = 0;
+   for (const auto& defaultLine : defaultBounds) {
+      auto soundLine = soundBounds.find(defaultLine.first);
+      if (soundLine == soundBounds.end()) {
+         fprintf(stderr, "%s: no sound bounds\n", defaultLine.first.c_str());
+         ++errors;
+         continue;
+      };
+      for (int field = 0; field < 3; ++field) {
+         // a top sound domain encloses everything
+         if (!defaultLine.second.hasField[field] || !soundLine->second.hasField[field])
+            continue;
+         if (!isEnclosed(defaultLine.second, soundLine->second, field)) {
+            fprintf(stderr, "%s: %s%.17g, %.17g] does not enclose [%.17g, %.17g]\n",
+                  defaultLine.first.c_str(), fieldPrefixes[field],
+                  soundLine->second.min[field], soundLine->second.max[field],
+                  defaultLine.second.min[field], defaultLine.second.max[field]);
+            ++errors;
+         };
+      };
+   };
+   printf("%d variables checked, %d not enclosed\n", (int) defaultBounds.size(), errors);
+   return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,147 @@
+/**************************************************************************/
+/*                                                                        */
+/*  Copyright (C) 2014-2025                                               */
+/*    CEA (Commissariat a l'Energie Atomique et aux Energies              */
+/*         Alternatives)                                                  */
+/*                                                                        */
+/*  you can redistribute it and/or modify it under the terms of the GNU   */
+/*  Lesser General Public License as published by the Free Software       */
+/*  Foundation, version 2.1.                                              */
+/*                                                                        */
+/*  It is distributed in the hope that it will be useful,                 */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         */
+/*  GNU Lesser General Public License for more details.                   */
+/*                                                                        */
+/*  See the GNU Lesser General Public License version 2.1                 */
+/*  for more details (enclosed in the file LICENSE).                      */
+/*                                                                        */
+/**************************************************************************/
+
+/////////////////////////////////
+//
+// Library   : NumericalDomains
+// Unit      : Affine relationships
+// File      : binary_trace.cpp
+// Description :
+//   Round trip of a first-follow trace between the text format and the
+//   binary format of -binary-trace.
+//
+
+#include "FloatAffine.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace NumericalDomains::DAffine;
+
+namespace {
+
+// records of the traces of comparison.cpp and unstable.cpp
+const char* szTrace =
+   "ut_f 4.99999911e-1, 4.99999970e-1, 4.99999949999999415695128845982253551483e-1 + "
+   "5.00000005843048711540177464485168457031e-8*u_2 = "
+   "[4.99999899999998831390257691964507102966e-1, "
+   "5.00000000000000000000000000000000000000e-1]\n"
+   "ut_f 0.00000000, 1.00000000, 5.00000050000000584304871154017746448517e-1 + "
+   "1.00000001168609742308035492897033691406e-7*u_1 + "
+   "5.00000005843048711540177464485168457031e-8*d_2 "
+   "{-2.50000050000000584304871154017746448517e-1 + "
+   "-1.00000001168609742308035492897033691406e-7*u_1 + "
+   "-2.50000050000000584304871154017746448517e-1*d_1 "
+   "{5.00000000000000000000000000000000000000e-1*e_1 + "
+   "1.00000001168609742308035492897033691406e-7*u_1 = "
+   "[-5.00000100000001168609742308035492897034e-1, "
+   "5.00000100000001168609742308035492897034e-1] } = "
+   "[-5.00000200000002337219484616070985794067e-1, "
+   "1.00000001168609742308035492897033691406e-7] } = "
+   "[4.99999899999998831390257691964507102966e-1, "
+   "5.00000200000002337219484616070985794067e-1]\n"
+   "ut_f 6.99999999999999956e-1, 6.99999999999999956e-1, "
+   "6.99999999999999955591079014993738383055e-1 + "
+   "5.55111512312578270211815834045410156250e-17*u_1 + "
+   "5.55111512312578270211815834045410156250e-17*u_2 = "
+   "[6.99999999999999844568776552478084340692e-1, "
+   "7.00000000000000066613381477509392425418e-1]\n"
+   "ut_r 6.99999999999999955591079014993738383055e-1 + "
+   "5.55111512312578270211815834045410156250e-17*u_1 = "
+   "[6.99999999999999900079927783735911361873e-1, "
+   "7.00000000000000011102230246251565404236e-1]\n"
+   "ut_f 6.99999999999999956e-1, 6.99999999999999956e-1, "
+   "6.99999999999999954591079014993738311512e-1 + "
+   "5.55111512312578270211815834045410156250e-17*e_1 + "
+   "5.55111512312578270211815834045410156250e-17*u_1 + "
+   "5.55111512312578270211815834045410156250e-17*u_2 + "
+   "-9.62964972193617926527988971292463659269e-35*u_3 + "
+   "-9.62964972193617926527988971292463659269e-35*u_4 = "
+   "[6.99999999999999788057625321220257055375e-1, "
+   "7.00000000000000121124532708767219567650e-1]\n"
+   "ut_r 6.99999999999999954591079014993738311512e-1 + "
+   "5.55111512312578270211815834045410156250e-17*u_1 + "
+   "-9.62964972193617926527988971292463659269e-35*u_3 = "
+   "[6.99999999999999899079927783735911194034e-1, "
+   "7.00000000000000010102230246251565428990e-1]\n"
+   "ut_f 0.00000000000000000, 0.00000000000000000, "
+   "0.00000000000000000000000000000000000000 = [0.00000000000000000000000000000000000000, "
+   "0.00000000000000000000000000000000000000]\n"
+   "ut_r 8.33333333333333423791548507328177672058e-19 + "
+   "8.02470810161348301804043143768120317732e-35*u_3 + "
+   "7.42436680849922907207593177441063735481e-51*h_10 = "
+   "[8.33333333333333343544467491193340067263e-19, "
+   "8.33333333333333504038629523463015276853e-19]\n"
+   "path condition: 1 1\n";
+
+std::string
+readFile(const char* fileName) {
+   std::ifstream in(fileName, std::ios_base::in | std::ios_base::binary);
+   std::ostringstream content;
+   content << in.rdbuf();
+   return content.str();
+}
+
+void
+writeFile(const char* fileName, const std::string& content) {
+   std::ofstream out(fileName, std::ios_base::out | std::ios_base::binary);
+   out << content;
+}
+
+} // end of namespace
+
+int
+main() {
+   int errors = 0;
+   std::string text = szTrace;
+   writeFile("binary_trace_out", text);
+   try {
+      ExecutionPath::convertTrace("binary_trace_out", "binary_trace_bin");
+      ExecutionPath::convertTrace("binary_trace_bin", "binary_trace_text");
+
+      // the path condition comes first in the _in files
+      std::string::size_type lastLine = text.rfind('\n', text.length()-2)+1;
+      writeFile("binary_trace_in", text.substr(lastLine) + text.substr(0, lastLine));
+      ExecutionPath::convertTrace("binary_trace_in", "binary_trace_in_bin");
+   }
+   catch (STG::EReadError& error) {
+      fprintf(stderr, "conversion error: %s\n", error.getMessage() ? error.getMessage() : "");
+      return 1;
+   };
+
+   std::string binary = readFile("binary_trace_bin");
+   if (binary.compare(0, 4, "FLDT") != 0 || binary.find("ut_f 4.99") != std::string::npos) {
+      fprintf(stderr, "the binary trace keeps the decimal values\n");
+      ++errors;
+   };
+   if (readFile("binary_trace_text") != text) {
+      fprintf(stderr, "the text trace differs after the round trip\n");
+      ++errors;
+   };
+   if (readFile("binary_trace_in_bin") != binary) {
+      fprintf(stderr, "the _in layout gives another binary trace\n");
+      ++errors;
+   };
+   printf("%d bytes of text trace, %d bytes of binary trace, %d differences\n",
+         (int) text.length(), (int) binary.length(), errors);
+   return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,119 @@
+/**************************************************************************/
+/*                                                                        */
+/*  Copyright (C) 2014-2025                                               */
+/*    CEA (Commissariat a l'Energie Atomique et aux Energies              */
+/*         Alternatives)                                                  */
+/*                                                                        */
+/*  you can redistribute it and/or modify it under the terms of the GNU   */
+/*  Lesser General Public License as published by the Free Software       */
+/*  Foundation, version 2.1.                                              */
+/*                                                                        */
+/*  It is distributed in the hope that it will be useful,                 */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         */
+/*  GNU Lesser General Public License for more details.                   */
+/*                                                                        */
+/*  See the GNU Lesser General Public License version 2.1                 */
+/*  for more details (enclosed in the file LICENSE).                      */
+/*                                                                        */
+/**************************************************************************/
+
+/////////////////////////////////
+//
+// Library   : ForwardNumerics
+// Unit      : Floating
+// File      : dual_rounding.cpp
+// Description :
+//   Randomized test of the dual rounding operations of the soft floating
+//   points against two computations with the lowest and the highest rounding.
+//
+
+#include "ForwardNumerics/BaseFloating.template"
+#include "ForwardNumerics/BaseFloatingGeneric.template"
+
+#include <cstdio>
+#include <cstring>
+#include <random>
+
+namespace {
+
+template <class TypeBuiltDouble, typename TypeChunk>
+class TDualRoundingTest {
+  private:
+   typedef typename TypeBuiltDouble::ReadParameters ReadParameters;
+   typedef void (TypeBuiltDouble::*PDualOperation)(const TypeBuiltDouble&, TypeBuiltDouble&,
+         ReadParameters&, ReadParameters&);
+   typedef TypeBuiltDouble& (TypeBuiltDouble::*POperation)(const TypeBuiltDouble&, ReadParameters&);
+
+   std::mt19937_64 mtGenerator;
+   const char* szName;
+   int uErrors = 0;
+
+   // small exponents, extreme exponents and exact values are frequent
+   TypeBuiltDouble randomDouble()
+      {  TypeChunk chunk = (TypeChunk) mtGenerator();
+         static const int UBitSizeMantissa = sizeof(TypeChunk) == 4 ? 23 : 52;
+         switch (mtGenerator() % 8) {
+            case 0: chunk &= ~(~(TypeChunk) 0 >> 1); break; // zero
+            case 1: chunk &= ~((~(TypeChunk) 0) >> 12); break; // short mantissa
+            case 2: chunk &= ((TypeChunk) 1 << (sizeof(TypeChunk)*8-1))
+                  | ((TypeChunk) 1 << (UBitSizeMantissa+3)) | ~(~(TypeChunk) 0 << UBitSizeMantissa);
+               break; // around one or denormalized
+         };
+         TypeBuiltDouble result;
+         result.setChunk(&chunk);
+         return result;
+      }
+   static bool isEqual(const TypeBuiltDouble& first, const TypeBuiltDouble& second)
+      {  TypeChunk firstChunk = 0, secondChunk = 0;
+         first.fillChunk(&firstChunk);
+         second.fillChunk(&secondChunk);
+         return firstChunk == secondChunk;
+      }
+   void check(const TypeBuiltDouble& first, const TypeBuiltDouble& second,
+         PDualOperation dualOperation, POperation operation, const char* operationName)
+      {  ReadParameters minParams, maxParams;
+         minParams.setLowestRound();
+         maxParams.setHighestRound();
+         TypeBuiltDouble min(first), max(first), minReference(first), maxReference(first);
+         (min.*dualOperation)(second, max, minParams, maxParams);
+         minParams.clear();
+         maxParams.clear();
+         (minReference.*operation)(second, minParams);
+         (maxReference.*operation)(second, maxParams);
+         if (!isEqual(min, minReference) || !isEqual(max, maxReference)) {
+            if (uErrors < 10)
+               fprintf(stderr, "%s: %s differs from the separate roundings\n", szName, operationName);
+            ++uErrors;
+         };
+      }
+
+  public:
+   TDualRoundingTest(const char* name) : mtGenerator(sizeof(TypeChunk)), szName(name) {}
+
+   int run(int iterations)
+      {  for (int iteration = 0; iteration < iterations; ++iteration) {
+            TypeBuiltDouble first = randomDouble(), second = randomDouble();
+            check(first, second, &TypeBuiltDouble::plusAssignDual, &TypeBuiltDouble::plusAssignDouble, "plus");
+            check(first, second, &TypeBuiltDouble::minusAssignDual, &TypeBuiltDouble::minusAssignDouble, "minus");
+            check(first, second, &TypeBuiltDouble::multAssignDual, &TypeBuiltDouble::multAssignDouble, "mult");
+            check(first, second, &TypeBuiltDouble::divAssignDual, &TypeBuiltDouble::divAssignDouble, "div");
+         };
+         printf("%s: %d random operands, %d differences\n", szName, iterations, uErrors);
+         return uErrors;
+      }
+};
+
+} // end of namespace
+
+int
+main() {
+   int errors = 0;
+   errors += TDualRoundingTest<Numerics::TBuiltDouble<Numerics::BuiltDoubleTraits<52, 11> >, uint64_t>
+      ("double").run(100000);
+   errors += TDualRoundingTest<Numerics::TBuiltDouble<Numerics::BuiltDoubleTraits<23, 8> >, uint32_t>
+      ("float").run(100000);
+   errors += TDualRoundingTest<Numerics::TGBuiltDouble<Numerics::GBuiltDoubleTraits<
+      Numerics::UnsignedLongBaseStoreTraits, 52, 11> >, uint64_t>("generic double").run(100000);
+   return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,151 @@
+/**************************************************************************/
+/*                                                                        */
+/*  Copyright (C) 2014-2025                                               */
+/*    CEA (Commissariat a l'Energie Atomique et aux Energies              */
+/*         Alternatives)                                                  */
+/*                                                                        */
+/*  you can redistribute it and/or modify it under the terms of the GNU   */
+/*  Lesser General Public License as published by the Free Software       */
+/*  Foundation, version 2.1.                                              */
+/*                                                                        */
+/*  It is distributed in the hope that it will be useful,                 */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         */
+/*  GNU Lesser General Public License for more details.                   */
+/*                                                                        */
+/*  See the GNU Lesser General Public License version 2.1                 */
+/*  for more details (enclosed in the file LICENSE).                      */
+/*                                                                        */
+/**************************************************************************/
+
+/////////////////////////////////
+//
+// Library   : ForwardNumerics
+// Unit      : Integer
+// File      : integer_kernels.cpp
+// Description :
+//   Randomized differential test of the carry kernels of the store traits
+//   against the half-cell algorithms of TSplitCellStoreTraits.
+//
+
+#include "ForwardNumerics/BaseIntegerGeneric.template"
+
+#include <cstdio>
+#include <random>
+
+namespace {
+
+template <class BaseStoreTraits, int UCellSize>
+class TDifferentialTest {
+  private:
+   typedef Numerics::TSplitCellStoreTraits<BaseStoreTraits> ReferenceStoreTraits;
+   typedef Numerics::TGBigCellInt<BaseStoreTraits,
+         Numerics::DInteger::TGCellIntegerTraits<BaseStoreTraits, UCellSize> > Kernel;
+   typedef Numerics::TGBigCellInt<ReferenceStoreTraits,
+         Numerics::DInteger::TGCellIntegerTraits<ReferenceStoreTraits, UCellSize> > Reference;
+   typedef typename BaseStoreTraits::BaseType BaseType;
+
+   std::mt19937_64 mtGenerator;
+   const char* szName;
+   int uErrors = 0;
+
+   // zero and saturated cells are frequent to exercise the carry chains
+   BaseType randomCell()
+      {  switch (mtGenerator() % 4) {
+            case 0: return (BaseType) 0;
+            case 1: return ~(BaseType) 0;
+         };
+         return (BaseType) mtGenerator();
+      }
+   void randomize(Kernel& kernel, Reference& reference)
+      {  for (int index = 0; index < UCellSize; ++index)
+            kernel[index] = reference[index] = randomCell();
+      }
+   template <class TypeFirst, class TypeSecond>
+   bool isEqual(const TypeFirst& first, const TypeSecond& second, int cellsNumber) const
+      {  for (int index = 0; index < cellsNumber; ++index)
+            if (first.carray(index) != second.carray(index))
+               return false;
+         return true;
+      }
+   void check(bool condition, const char* operation)
+      {  if (!condition) {
+            if (uErrors < 10)
+               fprintf(stderr, "%s: %s differs from the reference\n", szName, operation);
+            ++uErrors;
+         };
+      }
+
+  public:
+   TDifferentialTest(const char* name) : mtGenerator(UCellSize), szName(name) {}
+
+   int run(int iterations)
+      {  for (int iteration = 0; iteration < iterations; ++iteration) {
+            Kernel first, second;
+            Reference firstReference, secondReference;
+            randomize(first, firstReference);
+            randomize(second, secondReference);
+
+            typename Kernel::MultResult product;
+            typename Reference::MultResult productReference;
+            first.mult(second, product);
+            firstReference.mult(secondReference, productReference);
+            check(isEqual(product, productReference, 2*UCellSize), "mult");
+
+            BaseType cell = randomCell();
+            Kernel multiplied(first);
+            Reference multipliedReference(firstReference);
+            check(multiplied.multAssign(cell).carry() == multipliedReference.multAssign(cell).carry()
+                  && isEqual(multiplied, multipliedReference, UCellSize), "multAssign");
+
+            Kernel sum(first);
+            Reference sumReference(firstReference);
+            check(sum.add(second).carry() == sumReference.add(secondReference).carry()
+                  && isEqual(sum, sumReference, UCellSize), "add");
+
+            Kernel difference(first);
+            Reference differenceReference(firstReference);
+            check(difference.sub(second).carry() == differenceReference.sub(secondReference).carry()
+                  && isEqual(difference, differenceReference, UCellSize), "sub");
+
+            if (!first.isZero() && !second.isZero()) {
+               typename Kernel::DivisionResult quotient;
+               typename Reference::DivisionResult quotientReference;
+               first.div(second, quotient);
+               firstReference.div(secondReference, quotientReference);
+               check(quotient.comma() == quotientReference.comma()
+                     && isEqual(quotient.quotient(), quotientReference.quotient(), UCellSize)
+                     && isEqual(quotient.remainder(), quotientReference.remainder(), UCellSize), "div");
+            };
+
+            // operands with the 5 unused high bits of the mantissas of the floating-point division
+            first[UCellSize-1] = firstReference[UCellSize-1] = first.carray(UCellSize-1) & (~(BaseType) 0 >> 5);
+            second[UCellSize-1] = secondReference[UCellSize-1] = second.carray(UCellSize-1) & (~(BaseType) 0 >> 5);
+            typename Kernel::NormalizedDivisionResult division;
+            typename Reference::NormalizedDivisionResult divisionReference;
+            first.divNormalized(second, division);
+            firstReference.divNormalized(secondReference, divisionReference);
+            check(division.comma() == divisionReference.comma()
+                  && isEqual(division.quotient(), divisionReference.quotient(), UCellSize)
+                  && isEqual(division.remainder(), divisionReference.remainder(), UCellSize+1), "divNormalized");
+         };
+         printf("%s: %d random operands, %d differences\n", szName, iterations, uErrors);
+         return uErrors;
+      }
+};
+
+} // end of namespace
+
+int
+main() {
+   int errors = 0;
+   errors += TDifferentialTest<Numerics::UnsignedLongBaseStoreTraits, 2>("uint64_t x 2").run(100000);
+   errors += TDifferentialTest<Numerics::UnsignedLongBaseStoreTraits, 3>("uint64_t x 3").run(100000);
+   errors += TDifferentialTest<Numerics::UnsignedLongBaseStoreTraits, 4>("uint64_t x 4").run(100000);
+   errors += TDifferentialTest<Numerics::UnsignedBaseStoreTraits, 2>("uint32_t x 2").run(100000);
+   errors += TDifferentialTest<Numerics::UnsignedBaseStoreTraits, 3>("uint32_t x 3").run(100000);
+   errors += TDifferentialTest<Numerics::UnsignedBaseStoreTraits, 4>("uint32_t x 4").run(100000);
+   errors += TDifferentialTest<Numerics::UnsignedBaseStoreTraits, 5>("uint32_t x 5").run(100000);
+   return errors == 0 ? 0 : 1;
+}
+
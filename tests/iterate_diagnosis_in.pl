@@ -4,9 +4,33 @@ use warnings;
 
 use IO::File;
 use File::ReadBackwards;
+use File::Copy;
 
 use autodie; # die if problem reading or writing a file
 
+# binary traces of -binary-trace: the reader puts the last record first by itself
+my $fh_binary = IO::File->new($ARGV[0] . "_out", "r") or die;
+binmode($fh_binary);
+my $magic = "";
+$fh_binary->read($magic, 4);
+if ($magic eq "FLDT") {
+  my $header = "";
+  my $record = "";
+  my $length = "";
+  $fh_binary->read($header, 12);
+  while ($fh_binary->read($length, 4) == 4) {
+    $fh_binary->read($record, unpack("V", $length));
+  }
+  undef $fh_binary;
+  if (($record ne "path condition: 0\n") and ($record ne "path condition: 0 0\n")) {
+    copy($ARGV[0] . "_out", $ARGV[0] . "_in") or die;
+  }
+  elsif (-e ($ARGV[0] . "_in"))
+    { unlink ($ARGV[0] . "_in"); }
+  exit 0;
+}
+undef $fh_binary;
+
 my $fh_in = IO::File->new($ARGV[0] . "_out", "r") or die;
 my $condition = "";
 
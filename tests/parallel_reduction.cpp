@@ -0,0 +1,34 @@
+DECLARE_RESOURCES
+
+#define THREADS_NUMBER 4
+#define TERMS_NUMBER 40
+
+int main(int argc, char** argv) {
+  int result = 0;
+  INIT_MAIN
+
+  DTHREAD_VALUE partials[THREADS_NUMBER];
+  std::thread threads[THREADS_NUMBER];
+  int index;
+  for (index = 0; index < THREADS_NUMBER; ++index)
+     threads[index] = std::thread([index, &partials]() {
+        INIT_THREAD
+        double partial = 0.0;
+        int term;
+        for (term = index; term < TERMS_NUMBER; term += THREADS_NUMBER)
+           partial = partial + 1.0/(term+1);
+        partials[index] = FLOAT_THREAD_EXPORT(partial);
+     });
+  for (index = 0; index < THREADS_NUMBER; ++index)
+     threads[index].join();
+
+  double sum = 0.0;
+  for (index = 0; index < THREADS_NUMBER; ++index)
+     sum = sum + double(partials[index]);
+  DPRINT(sum);
+  if (FLOAT_IMPLEMENTATION(sum) < 4.27 || FLOAT_IMPLEMENTATION(sum) > 4.28)
+     result = 1;
+
+  END_MAIN
+  return result;
+}
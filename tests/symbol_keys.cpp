@@ -0,0 +1,86 @@
+/**************************************************************************/
+/*                                                                        */
+/*  Copyright (C) 2014-2025                                               */
+/*    CEA (Commissariat a l'Energie Atomique et aux Energies              */
+/*         Alternatives)                                                  */
+/*                                                                        */
+/*  you can redistribute it and/or modify it under the terms of the GNU   */
+/*  Lesser General Public License as published by the Free Software       */
+/*  Foundation, version 2.1.                                              */
+/*                                                                        */
+/*  It is distributed in the hope that it will be useful,                 */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         */
+/*  GNU Lesser General Public License for more details.                   */
+/*                                                                        */
+/*  See the GNU Lesser General Public License version 2.1                 */
+/*  for more details (enclosed in the file LICENSE).                      */
+/*                                                                        */
+/**************************************************************************/
+
+/////////////////////////////////
+//
+// Library   : NumericalDomains
+// Unit      : Affine relationships
+// File      : symbol_keys.cpp
+// Description :
+//   Randomized test of the sort keys of the symbols against their virtual
+//   comparison, that orders the coefficients of the affine forms.
+//
+
+#include "NumericalLattices/FloatAffineBaseCommon.h"
+
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace NumericalDomains::DAffine;
+
+namespace {
+
+Symbol*
+createSymbol(std::mt19937& generator) {
+   int order = (int) (generator() % 6);
+   Symbol* result = nullptr;
+   switch (generator() % 7) {
+      case 0: result = new CentralSymbol(); break;
+      case 1: result = new NoiseSymbol(); break;
+      case 2: result = new MarkedNoiseSymbol(order); break;
+      case 3: result = new ClosedSymbol((int) (generator() % 4)); break;
+      case 4: result = new HighLevelSymbol(); break;
+      case 5: result = new ConstrainedSymbol(order); break;
+      default:
+         result = new ClosedSymbol((1 << 28) - 1); break;
+   };
+   result->setOrder(order);
+   return result;
+}
+
+} // end of namespace
+
+int
+main() {
+   std::mt19937 generator(1);
+   std::vector<std::unique_ptr<Symbol> > symbols;
+   for (int index = 0; index < 200; ++index)
+      symbols.emplace_back(createSymbol(generator));
+
+   int errors = 0;
+   for (const auto& first : symbols) {
+      for (const auto& second : symbols) {
+         ComparisonResult expected = first->compare(*second);
+         Symbol::SortKey firstKey = first->getSortKey(), secondKey = second->getSortKey();
+         ComparisonResult result = (firstKey < secondKey) ? CRLess
+            : ((firstKey > secondKey) ? CRGreater : CREqual);
+         if (result != expected) {
+            if (errors < 10)
+               fprintf(stderr, "%s%d and %s%d: the sort keys differ from the comparison\n",
+                     first->getOwnPrefix(), first->getOrder(), second->getOwnPrefix(), second->getOrder());
+            ++errors;
+         };
+      };
+   };
+   printf("%d pairs of symbols, %d differences\n", (int) (symbols.size()*symbols.size()), errors);
+   return errors == 0 ? 0 : 1;
+}
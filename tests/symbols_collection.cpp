@@ -0,0 +1,106 @@
+/**************************************************************************/
+/*                                                                        */
+/*  Copyright (C) 2011-2025                                               */
+/*    CEA (Commissariat a l'Energie Atomique et aux Energies              */
+/*         Alternatives)                                                  */
+/*                                                                        */
+/*  you can redistribute it and/or modify it under the terms of the GNU   */
+/*  Lesser General Public License as published by the Free Software       */
+/*  Foundation, version 2.1.                                              */
+/*                                                                        */
+/*  It is distributed in the hope that it will be useful,                 */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         */
+/*  GNU Lesser General Public License for more details.                   */
+/*                                                                        */
+/*  See the GNU Lesser General Public License version 2.1                 */
+/*  for more details (enclosed in the file LICENSE).                      */
+/*                                                                        */
+/**************************************************************************/
+
+/////////////////////////////////
+//
+// Library   : NumericalDomains
+// Unit      : Affine relationships
+// File      : symbols_collection.cpp
+// Description :
+//   Test of the collection of the noise symbols that no form refers to,
+//   with the pattern of a filter: every step adds a symbol to a form that
+//   forgets its oldest symbol.
+//
+
+#include "NumericalLattices/FloatAffineBaseCommon.h"
+#include "Pointer/Vector.template"
+
+#include <cstdio>
+
+using namespace NumericalDomains::DAffine;
+
+namespace {
+
+typedef PNT::TSharedCollection<Symbol, HandlerCast<Symbol, PNT::SharedCollection::Element> > Form;
+
+// the symbols of the form should be the last created symbols, in increasing order
+bool
+checkForm(const Form& form, const SymbolsManager& manager) {
+   int expectedOrder = manager.getMaxNoiseSymbolOrder() - form.count();
+   Form::Cursor cursor(form);
+   while (cursor.setToNext()) {
+      const Symbol& symbol = cursor.elementAt();
+      if (symbol.getOrder() != ++expectedOrder
+            || manager.locateSymbol(Symbol::TNoise, symbol.getOrder()) != &symbol)
+         return false;
+   };
+   return expectedOrder == manager.getMaxNoiseSymbolOrder();
+}
+
+bool
+filter(int steps, int window, bool doesCompact) {
+   SymbolsManager manager;
+   manager.setCollectNoiseSymbols();
+   manager.setCompactNoiseSymbols(doesCompact);
+   Form form;
+   bool result = true;
+   for (int step = 0; step < steps; ++step) {
+      form.addElement(*manager.createNoiseSymbol());
+      if (form.count() > window) {
+         Form::Cursor cursor(form);
+         cursor.setToFirst();
+         form.removeAt(cursor);
+      };
+      if (step % 1000 == 0)
+         result = checkForm(form, manager) && result;
+   };
+   result = checkForm(form, manager) && result;
+   if (manager.getCreatedNoiseSymbols() != steps || manager.getPeakNoiseSymbols() > 2*window + 1024)
+      result = false;
+   if (doesCompact ? manager.getMaxNoiseSymbolOrder() > 2*window + 1024
+         : manager.getMaxNoiseSymbolOrder() != steps)
+      result = false;
+
+   // a reclaimed order is restored by a new symbol, as when an equation is read back
+   if (!doesCompact) {
+      if (manager.locateSymbol(Symbol::TNoise, 1))
+         result = false;
+      Symbol& restored = manager.restoreNoiseSymbol(1);
+      if (restored.getOrder() != 1 || &manager.findNoiseSymbol(1) != &restored
+            || &manager.restoreNoiseSymbol(1) != &restored)
+         result = false;
+      result = checkForm(form, manager) && result;
+   };
+   printf("%d steps, window of %d symbols%s: %d created, %d peak live, last order %d%s\n",
+         steps, window, doesCompact ? ", compacted orders" : "", manager.getCreatedNoiseSymbols(),
+         manager.getPeakNoiseSymbols(), manager.getMaxNoiseSymbolOrder(), result ? "" : " [error]");
+   return result;
+}
+
+} // end of namespace
+
+int
+main() {
+   bool result = filter(100000, 10, false);
+   result = filter(100000, 3000, false) && result;
+   result = filter(100000, 10, true) && result;
+   result = filter(100000, 3000, true) && result;
+   return result ? 0 : 1;
+}
@@ -0,0 +1,174 @@
+/**************************************************************************/
+/*                                                                        */
+/*  Copyright (C) 2014-2025                                               */
+/*    CEA (Commissariat a l'Energie Atomique et aux Energies              */
+/*         Alternatives)                                                  */
+/*                                                                        */
+/*  you can redistribute it and/or modify it under the terms of the GNU   */
+/*  Lesser General Public License as published by the Free Software       */
+/*  Foundation, version 2.1.                                              */
+/*                                                                        */
+/*  It is distributed in the hope that it will be useful,                 */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         */
+/*  GNU Lesser General Public License for more details.                   */
+/*                                                                        */
+/*  See the GNU Lesser General Public License version 2.1                 */
+/*  for more details (enclosed in the file LICENSE).                      */
+/*                                                                        */
+/**************************************************************************/
+
+/////////////////////////////////
+//
+// Library   : ForwardNumerics
+// Unit      : Floating
+// File      : taylor_kernels.cpp
+// Description :
+//   Randomized test of the enclosures of sin, cos, atan and pow computed
+//   by the soft floating points against the long double host functions.
+//
+
+#include "ForwardNumerics/BaseFloating.template"
+#include "ForwardNumerics/BaseTaylorFloating.template"
+#include "Numerics/Integer.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+
+namespace {
+
+class TaylorKernelsTest {
+  private:
+   typedef Numerics::TBuiltDouble<Numerics::BuiltDoubleTraits<52, 11> > BuiltDouble;
+   typedef Numerics::TTaylorDouble<BuiltDouble,
+         Numerics::TBuiltDouble<Numerics::BuiltDoubleTraits<57, 11> >,
+         Numerics::BigInteger> TaylorDouble;
+   typedef BuiltDouble::ReadParameters ReadParameters;
+
+   std::mt19937_64 mtGenerator;
+   int uErrors = 0;
+   int uChecks = 0;
+
+   static BuiltDouble asBuilt(double value)
+      {  uint64_t chunk;
+         memcpy(&chunk, &value, sizeof(chunk));
+         BuiltDouble result;
+         result.setChunk(&chunk);
+         return result;
+      }
+   static double asDouble(const BuiltDouble& value)
+      {  uint64_t chunk = 0;
+         value.fillChunk(&chunk);
+         double result;
+         memcpy(&result, &chunk, sizeof(result));
+         return result;
+      }
+   // random magnitude between 2^minExponent and 2^maxExponent
+   double randomDouble(int minExponent, int maxExponent)
+      {  double result = std::ldexp(1.0 + (double) (mtGenerator() >> 12) / 4503599627370496.0,
+            minExponent + (int) (mtGenerator() % (uint64_t) (maxExponent - minExponent + 1)));
+         return (mtGenerator() & 1) ? -result : result;
+      }
+
+   // the host reference is far more precise than one double ulp
+   // widthFactor accounts for the amplification of the rounding errors by pow
+   void check(double argument, const char* name, long double reference,
+         const TaylorDouble& result, const BuiltDouble& errorMin, const BuiltDouble& errorMax,
+         long double widthFactor=1.0L)
+      {  long double value = asDouble(result);
+         long double min = value + (long double) asDouble(errorMin);
+         long double max = value + (long double) asDouble(errorMax);
+         long double tolerance = std::fabs(reference) * 0x1p-60L + 0x1p-1070L;
+         long double ulp = std::fabs(reference) * widthFactor * 0x1p-50L + 0x1p-1070L;
+         ++uChecks;
+         if (!(min <= reference + tolerance && reference - tolerance <= max)
+               || !(max - min <= ulp)) {
+            if (uErrors < 10)
+               fprintf(stderr, "%s(%.17g): [%.21Lg, %.21Lg] does not tightly enclose %.21Lg\n",
+                  name, argument, min, max, reference);
+            ++uErrors;
+         };
+      }
+   void checkTrigonometric(double argument)
+      {  ReadParameters params;
+         params.setNearestRound().setRoundToEven();
+         BuiltDouble errorMin, errorMax;
+         TaylorDouble result(asBuilt(argument));
+         if (result.sinAssign(errorMin, errorMax, params))
+            check(argument, "sin", std::sin((long double) argument), result, errorMin, errorMax);
+         params.clear();
+         result = TaylorDouble(asBuilt(argument));
+         if (result.cosAssign(errorMin, errorMax, params))
+            check(argument, "cos", std::cos((long double) argument), result, errorMin, errorMax);
+         params.clear();
+      }
+   void checkInterval(double min, double max)
+      {  ReadParameters params;
+         params.setNearestRound().setRoundToEven();
+         TaylorDouble lower(asBuilt(min));
+         BuiltDouble upper(asBuilt(max));
+         lower.sinIntervalAssign(upper, params);
+         long double lowerValue = asDouble(lower), upperValue = asDouble(upper);
+         for (int sample = 0; sample <= 16; ++sample) {
+            long double point = (long double) min + ((long double) max - min) * sample / 16;
+            long double reference = std::sin(point);
+            ++uChecks;
+            if (reference < lowerValue - 0x1p-60L || reference > upperValue + 0x1p-60L) {
+               if (uErrors < 10)
+                  fprintf(stderr, "sin([%.17g, %.17g]) = [%.17Lg, %.17Lg] misses %.21Lg\n",
+                     min, max, lowerValue, upperValue, reference);
+               ++uErrors;
+            };
+         };
+      }
+
+  public:
+   TaylorKernelsTest() : mtGenerator(19) {}
+
+   int run(int iterations)
+      {  static const double specialArguments[] = {
+            0.0, -0.0, 1e-310, 1.0, 1.5707963267948966, 3.141592653589793, 6.283185307179586,
+            355.0, 103993.0, 1e22, 6381956970095103.0 * 0x1p797, 1.7976931348623157e308
+         };
+         for (double argument : specialArguments) {
+            checkTrigonometric(argument);
+            checkTrigonometric(-argument);
+         };
+         for (int iteration = 0; iteration < iterations; ++iteration) {
+            checkTrigonometric(randomDouble(-30, 4));
+            checkTrigonometric(randomDouble(4, 1023));
+
+            ReadParameters params;
+            params.setNearestRound().setRoundToEven();
+            BuiltDouble errorMin, errorMax;
+            double argument = randomDouble(-20, 60);
+            TaylorDouble result(asBuilt(argument));
+            result.atanAssign(errorMin, errorMax, params);
+            params.clear();
+            check(argument, "atan", std::atan((long double) argument), result, errorMin, errorMax);
+
+            argument = std::fabs(randomDouble(-8, 8));
+            double exponent = randomDouble(-6, 3);
+            result = TaylorDouble(asBuilt(argument));
+            if (result.powAssign(asBuilt(exponent), errorMin, errorMax, params))
+               check(argument, "pow", std::pow((long double) argument, (long double) exponent),
+                     result, errorMin, errorMax,
+                     2.0L*(1.0L + std::fabs(exponent * std::log((long double) argument))));
+            params.clear();
+
+            double min = randomDouble(-4, 6);
+            checkInterval(min, min + std::fabs(randomDouble(-6, 2)));
+         };
+         printf("taylor kernels: %d enclosures, %d errors\n", uChecks, uErrors);
+         return uErrors;
+      }
+};
+
+} // end of namespace
+
+int
+main() {
+   return TaylorKernelsTest().run(2000) == 0 ? 0 : 1;
+}
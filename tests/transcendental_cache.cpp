@@ -0,0 +1,162 @@
+/**************************************************************************/
+/*                                                                        */
+/*  Copyright (C) 2014-2025                                               */
+/*    CEA (Commissariat a l'Energie Atomique et aux Energies              */
+/*         Alternatives)                                                  */
+/*                                                                        */
+/*  you can redistribute it and/or modify it under the terms of the GNU   */
+/*  Lesser General Public License as published by the Free Software       */
+/*  Foundation, version 2.1.                                              */
+/*                                                                        */
+/*  It is distributed in the hope that it will be useful,                 */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         */
+/*  GNU Lesser General Public License for more details.                   */
+/*                                                                        */
+/*  See the GNU Lesser General Public License version 2.1                 */
+/*  for more details (enclosed in the file LICENSE).                      */
+/*                                                                        */
+/**************************************************************************/
+
+/////////////////////////////////
+//
+// Library   : NumericalDomains
+// Unit      : Affine relationships
+// File      : transcendental_cache.cpp
+// Description :
+//   Test of the memoization of the transcendental functions on the real
+//   bounds of the affine forms: a cached result should be the result of
+//   the computation, whatever the size of the table.
+//
+
+#include "fldlib_config.h"
+#include "NumericalAnalysis/FloatAffineExecutionPath.h"
+
+#include <cstdio>
+
+using namespace NumericalDomains::DAffine;
+
+namespace {
+
+typedef BuiltReal::ReadParameters ReadParameters;
+typedef BuiltReal::BaseDouble BaseDouble;
+
+bool
+isSame(const BaseDouble& first, const BaseDouble& second) {
+   return first.isNegative() == second.isNegative()
+      && first.getBasicExponent() == second.getBasicExponent()
+      && first.getMantissa() == second.getMantissa();
+}
+
+// numerator/denominator rounded to the nearest
+BuiltReal
+fraction(int64_t numerator, int64_t denominator) {
+   ReadParameters params;
+   params.setNearestRound().setRoundToEven();
+   BuiltReal::IntConversion conversion;
+   conversion.setSigned();
+   conversion.assign(numerator);
+   BuiltReal result;
+   result.setInteger(conversion, params);
+   conversion.assign(denominator);
+   BuiltReal divisor;
+   divisor.setInteger(conversion, params);
+   result.divAssign(divisor, params);
+   return result;
+}
+
+class Results {
+  public:
+   BuiltReal brExp, brLog, brAtan, brPow, brSinMin, brCosMin;
+   BaseDouble bdExpMin, bdExpMax, bdLogMin, bdLogMax, bdAtanMin, bdAtanMax, bdPowMin, bdPowMax;
+   BaseDouble bdSinMax, bdCosMax;
+   bool fIsPowComputed = false;
+
+   Results(const BuiltReal& first, const BuiltReal& second, bool isUpper)
+      {  ReadParameters params;
+         if (isUpper)
+            params.setHighestRound();
+         else
+            params.setNearestRound().setRoundToEven();
+         brExp = first; brExp.expAssign(bdExpMin, bdExpMax, params); params.clear();
+         brLog = second; brLog.logAssign(bdLogMin, bdLogMax, params); params.clear();
+         brAtan = first; brAtan.atanAssign(bdAtanMin, bdAtanMax, params); params.clear();
+         brPow = second;
+         fIsPowComputed = brPow.powAssign(first, bdPowMin, bdPowMax, params); params.clear();
+         brSinMin = first; bdSinMax = second; brSinMin.sinIntervalAssign(bdSinMax, params); params.clear();
+         brCosMin = first; bdCosMax = second; brCosMin.cosIntervalAssign(bdCosMax, params); params.clear();
+      }
+
+   bool operator==(const Results& source) const
+      {  return isSame(brExp, source.brExp) && isSame(bdExpMin, source.bdExpMin)
+            && isSame(bdExpMax, source.bdExpMax)
+            && isSame(brLog, source.brLog) && isSame(bdLogMin, source.bdLogMin)
+            && isSame(bdLogMax, source.bdLogMax)
+            && isSame(brAtan, source.brAtan) && isSame(bdAtanMin, source.bdAtanMin)
+            && isSame(bdAtanMax, source.bdAtanMax)
+            && fIsPowComputed == source.fIsPowComputed
+            && (!fIsPowComputed || (isSame(brPow, source.brPow)
+                  && isSame(bdPowMin, source.bdPowMin) && isSame(bdPowMax, source.bdPowMax)))
+            && isSame(brSinMin, source.brSinMin) && isSame(bdSinMax, source.bdSinMax)
+            && isSame(brCosMin, source.brCosMin) && isSame(bdCosMax, source.bdCosMax);
+      }
+};
+
+// every pair of arguments is evaluated with the table of the given size and without it
+bool
+compare(int size, int count, unsigned long& hits) {
+   BuiltReal::TranscendentalCache& cache = BuiltReal::transcendentalCache();
+   bool result = true;
+   for (int pass = 0; pass < 2; ++pass) {
+      for (int index = 1; index <= count; ++index) {
+         BuiltReal first = fraction(index, 7), second = fraction(3*index+1, 5);
+         for (int mode = 0; mode < 2; ++mode) {
+            cache.setSize(0);
+            Results reference(first, second, mode == 1);
+            cache.setSize(size);
+            for (int call = 0; call < 3; ++call) {
+               if (!(Results(first, second, mode == 1) == reference))
+                  result = false;
+            };
+         };
+      };
+   };
+   hits = cache.getHits();
+   return result;
+}
+
+} // end of namespace
+
+int
+main() {
+   bool result = true;
+   BuiltReal::TranscendentalCache& cache = BuiltReal::transcendentalCache();
+
+   // setSize clears the table, hence the second and the third calls hit
+   //   but for the rare collisions of the 6 functions
+   unsigned long hits = 0;
+   unsigned long previousHits = cache.getHits();
+   result = compare(4096, 20, hits) && result;
+   if ((hits - previousHits)*10 < 9*(2*20*2*2*6))
+      result = false;
+   printf("large table: %lu hits over %lu calls%s\n", hits - previousHits,
+         cache.getHits() + cache.getMisses(), result ? "" : " [error]");
+
+   // collisions in a small table do not change the results
+   bool smallResult = compare(7, 20, hits);
+   printf("small table: %s\n", smallResult ? "same results" : "different results [error]");
+
+   cache.setSize(0);
+   previousHits = cache.getHits();
+   BuiltReal value = fraction(1, 3);
+   for (int call = 0; call < 2; ++call) {
+      ReadParameters params;
+      params.setNearestRound().setRoundToEven();
+      BaseDouble errorMin, errorMax;
+      BuiltReal copy = value;
+      copy.expAssign(errorMin, errorMax, params);
+   };
+   bool disabledResult = cache.getHits() == previousHits;
+   printf("disabled table: %s\n", disabledResult ? "no hit" : "hits [error]");
+   return (result && smallResult && disabledResult) ? 0 : 1;
+}
@@ -0,0 +1,22 @@
+DECLARE_RESOURCES
+
+int main(int argc, char** argv) {
+  INIT_MAIN
+
+  double x = DBETWEEN(0.0, 1.0);
+  double y = DBETWEEN(0.0, 1.0);
+  double z = 0.0;
+  int i;
+  for (i = 0; i < 6; ++i) {
+     double t = x*0.3 + y*0.7 + 0.01*i;
+     if (t < 0.5)
+        z = z + t;
+     else
+        z = z - t;
+     y = y*0.9 + 0.05;
+  };
+  DPRINT(z);
+
+  END_MAIN
+  return 0;
+}
@@ -0,0 +1,190 @@
+/**************************************************************************/
+/*                                                                        */
+/*  Copyright (C) 2013-2025                                               */
+/*    CEA (Commissariat a l'Energie Atomique et aux Energies              */
+/*         Alternatives)                                                  */
+/*                                                                        */
+/*  you can redistribute it and/or modify it under the terms of the GNU   */
+/*  Lesser General Public License as published by the Free Software       */
+/*  Foundation, version 2.1.                                              */
+/*                                                                        */
+/*  It is distributed in the hope that it will be useful,                 */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         */
+/*  GNU Lesser General Public License for more details.                   */
+/*                                                                        */
+/*  See the GNU Lesser General Public License version 2.1                 */
+/*  for more details (enclosed in the file LICENSE).                      */
+/*                                                                        */
+/**************************************************************************/
+
+/////////////////////////////////
+//
+// Library   : Pointer
+// Unit      : Allocation
+// File      : NodePool.cpp
+// Description :
+//   Implementation of the class NodePool that allocates the small nodes with a
+//   high turnover (symbols, coefficients of affine forms) in size classes.
+//
+
+#include "fldlib_config.h"
+#include "Pointer/NodePool.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace PNT {
+
+#ifdef FLOAT_POOL_ALLOCATION
+
+namespace {
+
+struct Chunk {
+   enum State { SFull, SPartial, SEmpty };
+   Chunk* pcNext;
+   Chunk* pcPrevious;
+   void* pvFreeBlocks;  // blocks released by NodePool::free
+   char* pcUnused;      // blocks never allocated
+   size_t uLiveBlocks;
+   State sState;
+
+   char* start() { return ((char*) this) + ((sizeof(Chunk) + NodePool::UAlignment-1) & ~(NodePool::UAlignment-1)); }
+   char* end() { return ((char*) this) + NodePool::UChunkSize; }
+};
+
+struct ChunkList {
+   Chunk* pcFirst;
+   size_t uCount;
+
+   void insert(Chunk* chunk, Chunk::State state)
+      {  chunk->pcPrevious = nullptr;
+         chunk->pcNext = pcFirst;
+         if (pcFirst)
+            pcFirst->pcPrevious = chunk;
+         pcFirst = chunk;
+         chunk->sState = state;
+         ++uCount;
+      }
+   void remove(Chunk* chunk)
+      {  if (chunk->pcPrevious)
+            chunk->pcPrevious->pcNext = chunk->pcNext;
+         else
+            pcFirst = chunk->pcNext;
+         if (chunk->pcNext)
+            chunk->pcNext->pcPrevious = chunk->pcPrevious;
+         chunk->pcNext = chunk->pcPrevious = nullptr;
+         chunk->sState = Chunk::SFull;
+         --uCount;
+      }
+};
+
+struct SizeClass {
+   ChunkList clPartial;
+   ChunkList clEmpty;
+};
+
+// zero-initialized and without destructor, so the nodes freed by the static
+// destructors of the program still find their size class.
+// With FLOAT_THREAD_LOCAL_STATE, every thread has its own pool and a node
+// should be freed by the thread that has allocated it.
+FLOAT_THREAD_LOCAL SizeClass ascSizeClasses[NodePool::UMaxBlockSize / NodePool::UAlignment];
+FLOAT_THREAD_LOCAL size_t uLiveBlocksNumber;
+FLOAT_THREAD_LOCAL size_t uChunksNumber;
+
+}
+
+void*
+NodePool::allocate(size_t size) {
+   if (size > UMaxBlockSize)
+      return ::operator new(size);
+   size_t sizeIndex = (size > 0) ? (size-1) / UAlignment : 0;
+   size_t blockSize = (sizeIndex+1) * UAlignment;
+   SizeClass& sizeClass = ascSizeClasses[sizeIndex];
+   Chunk* chunk = sizeClass.clPartial.pcFirst;
+   if (!chunk) {
+      chunk = sizeClass.clEmpty.pcFirst;
+      if (chunk)
+         sizeClass.clEmpty.remove(chunk);
+      else {
+         chunk = (Chunk*) std::aligned_alloc(UChunkSize, UChunkSize);
+         if (!chunk)
+            throw std::bad_alloc();
+         ++uChunksNumber;
+         chunk->pvFreeBlocks = nullptr;
+         chunk->pcUnused = chunk->start();
+         chunk->uLiveBlocks = 0;
+      };
+      sizeClass.clPartial.insert(chunk, Chunk::SPartial);
+   };
+
+   void* result;
+   if (chunk->pvFreeBlocks) {
+      result = chunk->pvFreeBlocks;
+      chunk->pvFreeBlocks = *(void**) result;
+   }
+   else {
+      result = chunk->pcUnused;
+      chunk->pcUnused += blockSize;
+   };
+   ++chunk->uLiveBlocks;
+   ++uLiveBlocksNumber;
+   if (!chunk->pvFreeBlocks && chunk->pcUnused + blockSize > chunk->end())
+      sizeClass.clPartial.remove(chunk);
+   return result;
+}
+
+void
+NodePool::free(void* block, size_t size) {
+   if (!block)
+      return;
+   if (size > UMaxBlockSize) {
+      ::operator delete(block, size);
+      return;
+   };
+   size_t sizeIndex = (size > 0) ? (size-1) / UAlignment : 0;
+   SizeClass& sizeClass = ascSizeClasses[sizeIndex];
+   Chunk* chunk = (Chunk*) ((uintptr_t) block & ~(uintptr_t) (UChunkSize-1));
+   *(void**) block = chunk->pvFreeBlocks;
+   chunk->pvFreeBlocks = block;
+   --uLiveBlocksNumber;
+   if (chunk->sState == Chunk::SFull)
+      sizeClass.clPartial.insert(chunk, Chunk::SPartial);
+   if (--chunk->uLiveBlocks == 0) {
+      sizeClass.clPartial.remove(chunk);
+      chunk->pvFreeBlocks = nullptr;
+      chunk->pcUnused = chunk->start();
+      sizeClass.clEmpty.insert(chunk, Chunk::SEmpty);
+   };
+}
+
+void
+NodePool::reclaim(bool keepsReserve) {
+   for (auto& sizeClass : ascSizeClasses) {
+      while (sizeClass.clEmpty.pcFirst && (!keepsReserve || sizeClass.clEmpty.uCount > 1)) {
+         Chunk* chunk = sizeClass.clEmpty.pcFirst;
+         sizeClass.clEmpty.remove(chunk);
+         std::free(chunk);
+         --uChunksNumber;
+      };
+   };
+}
+
+bool NodePool::isActive() { return true; }
+size_t NodePool::queryLiveBlocksNumber() { return uLiveBlocksNumber; }
+size_t NodePool::queryChunksNumber() { return uChunksNumber; }
+
+#else // !FLOAT_POOL_ALLOCATION
+
+void* NodePool::allocate(size_t size) { return ::operator new(size); }
+void NodePool::free(void* block, size_t size) { ::operator delete(block, size); }
+void NodePool::reclaim(bool /* keepsReserve */) {}
+bool NodePool::isActive() { return false; }
+size_t NodePool::queryLiveBlocksNumber() { return 0; }
+size_t NodePool::queryChunksNumber() { return 0; }
+
+#endif // FLOAT_POOL_ALLOCATION
+
+} // end of namespace PNT
+
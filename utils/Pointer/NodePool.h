@@ -0,0 +1,75 @@
+/**************************************************************************/
+/*                                                                        */
+/*  Copyright (C) 2013-2025                                               */
+/*    CEA (Commissariat a l'Energie Atomique et aux Energies              */
+/*         Alternatives)                                                  */
+/*                                                                        */
+/*  you can redistribute it and/or modify it under the terms of the GNU   */
+/*  Lesser General Public License as published by the Free Software       */
+/*  Foundation, version 2.1.                                              */
+/*                                                                        */
+/*  It is distributed in the hope that it will be useful,                 */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         */
+/*  GNU Lesser General Public License for more details.                   */
+/*                                                                        */
+/*  See the GNU Lesser General Public License version 2.1                 */
+/*  for more details (enclosed in the file LICENSE).                      */
+/*                                                                        */
+/**************************************************************************/
+
+/////////////////////////////////
+//
+// Library   : Pointer
+// Unit      : Allocation
+// File      : NodePool.h
+// Description :
+//   Definition of the class NodePool that allocates the small nodes with a
+//   high turnover (symbols, coefficients of affine forms) in size classes.
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace PNT {
+
+/************************************/
+/* Definition of the class NodePool */
+/************************************/
+
+// The blocks of a size class are carved into aligned chunks. Each chunk has its
+// own free list and its number of live blocks, so that a chunk without live
+// blocks can be given back to the system by reclaim. Blocks larger than
+// UMaxBlockSize are delegated to the global allocator.
+// The library is compiled with FLOAT_POOL_ALLOCATION to activate the pool.
+// With FLOAT_THREAD_LOCAL_STATE, the pool and its counters are local to each thread.
+// Otherwise allocate and free directly call the global allocator.
+
+class NodePool {
+  public:
+   static const size_t UMaxBlockSize = 256;
+   static const size_t UAlignment = 16;
+   static const size_t UChunkSize = 64*1024;
+
+   static void* allocate(size_t size);
+   static void free(void* block, size_t size);
+   // gives back the chunks without live blocks, except one per size class if keepsReserve
+   static void reclaim(bool keepsReserve=false);
+
+   static bool isActive();
+   static size_t queryLiveBlocksNumber();
+   static size_t queryChunksNumber();
+};
+
+} // end of namespace PNT
+
+#if !defined(DefineDebugLevel) || DefineDebugLevel <= 2
+#define DefineNodePoolAllocation                                                                 \
+   static void* operator new(size_t size) { return PNT::NodePool::allocate(size); }              \
+   static void operator delete(void* block, size_t size) { PNT::NodePool::free(block, size); }
+#else
+// the new keyword is a macro that records the source location of the allocations
+#define DefineNodePoolAllocation
+#endif
+
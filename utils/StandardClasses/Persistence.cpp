@@ -34,6 +34,11 @@ namespace {}
 
 #include <iostream>
 #include <sstream>
+#include <fstream>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <type_traits>
 
 namespace STG {
 
@@ -70,6 +75,434 @@ EWriteError::EWriteError(const char* message)
 #undef DefineTypeObject
 #undef DefineImplementsOStreamMethods
 
+   /* class ISBuffer */
+
+namespace {
+
+class MemoryStreamBuffer : public std::streambuf {
+  public:
+   MemoryStreamBuffer(const char* begin, const char* end)
+      {  setg(const_cast<char*>(begin), const_cast<char*>(begin), const_cast<char*>(end)); }
+   const char* current() const { return gptr(); }
+};
+
+} // end of anonymous namespace
+
+bool
+IOObject::ISBuffer::loadFile(const char* fileName) {
+   std::ifstream in(fileName, std::ios_base::in | std::ios_base::binary);
+   if (!in.good()) {
+      setContent(std::string());
+      uState = SFail;
+      return false;
+   };
+   std::string content;
+   in.seekg(0, std::ios_base::end);
+   std::streamoff size = in.tellg();
+   in.seekg(0, std::ios_base::beg);
+   if (size > 0) {
+      content.resize((size_t) size);
+      in.read(&content[0], size);
+      content.resize((size_t) in.gcount());
+   };
+   setContent(std::move(content));
+   return true;
+}
+
+bool
+IOObject::ISBuffer::skipSpaces() {
+   if (uState != SGood) {
+      uState |= SFail;
+      return false;
+   };
+   while (pcCurrent < pcEnd && isspace((unsigned char) *pcCurrent))
+      ++pcCurrent;
+   if (pcCurrent == pcEnd) {
+      uState |= SEof | SFail;
+      return false;
+   };
+   return true;
+}
+
+template <typename TypeInteger>
+void
+IOObject::ISBuffer::readInteger(TypeInteger& n, int base) {
+   typedef typename std::make_unsigned<TypeInteger>::type TypeUnsigned;
+   if (!skipSpaces())
+      return;
+   bool isNegative = false;
+   if (*pcCurrent == '+' || *pcCurrent == '-') {
+      isNegative = (*pcCurrent == '-');
+      ++pcCurrent;
+   };
+   if (base == 16 && pcEnd - pcCurrent >= 2 && pcCurrent[0] == '0'
+         && (pcCurrent[1] == 'x' || pcCurrent[1] == 'X'))
+      pcCurrent += 2;
+   TypeUnsigned value = 0;
+   std::from_chars_result result = std::from_chars(pcCurrent, pcEnd, value, base);
+   if (result.ec == std::errc::invalid_argument) {
+      n = 0;
+      uState |= (pcCurrent == pcEnd) ? (SEof | SFail) : SFail;
+      return;
+   };
+   pcCurrent = result.ptr;
+   if (pcCurrent == pcEnd)
+      uState |= SEof;
+   bool isOverflow = result.ec == std::errc::result_out_of_range;
+   if (std::is_signed<TypeInteger>::value) {
+      TypeUnsigned limit = (TypeUnsigned) std::numeric_limits<TypeInteger>::max();
+      if (isOverflow || value > limit + (isNegative ? 1 : 0)) {
+         n = isNegative ? std::numeric_limits<TypeInteger>::min() : std::numeric_limits<TypeInteger>::max();
+         uState |= SFail;
+      }
+      else
+         n = isNegative ? (TypeInteger) (TypeUnsigned) (0 - value) : (TypeInteger) value;
+   }
+   else if (isOverflow) {
+      n = std::numeric_limits<TypeInteger>::max();
+      uState |= SFail;
+   }
+   else
+      n = isNegative ? (TypeInteger) (0 - value) : (TypeInteger) value;
+}
+
+void
+IOObject::ISBuffer::readRaw(void* value, int size) {
+   if (uState != SGood || pcEnd - pcCurrent < size) {
+      uLastCount = (uState != SGood) ? 0 : (int) (pcEnd - pcCurrent);
+      pcCurrent = (uState != SGood) ? pcCurrent : pcEnd;
+      uState |= SEof | SFail;
+      throw STG::EReadError();
+   };
+   memcpy(value, pcCurrent, size);
+   pcCurrent += size;
+   uLastCount = size;
+}
+
+int
+IOObject::ISBuffer::readsome(const STG::VirtualStringProperty& source, int n) {
+   AssumeValidity(*this)
+   MemoryStreamBuffer buffer(pcCurrent, pcEnd);
+   std::istream in(&buffer);
+   source.read(&in, n);
+   pcCurrent = buffer.current();
+   return source.length();
+}
+
+STG::IOObject::ISBase&
+IOObject::ISBuffer::seekg(int pos) {
+   AssumeValidity(*this)
+   uState &= ~SEof;
+   if (uState == SGood) {
+      if (pos >= 0 && pos <= pcEnd - pcBegin)
+         pcCurrent = pcBegin + pos;
+      else
+         uState |= SFail;
+   };
+   return *this;
+}
+
+STG::IOObject::ISBase&
+IOObject::ISBuffer::seekg(int pos, int origin) {
+   AssumeValidity(*this)
+   const char* base = (origin == std::ios_base::cur) ? pcCurrent
+      : ((origin == std::ios_base::end) ? pcEnd : pcBegin);
+   return seekg((int) (base - pcBegin) + pos);
+}
+
+STG::IOObject::ISBase&
+IOObject::ISBuffer::assume(void* achunk) {
+   AssumeValidity(*this)
+   STG::TChunk<char>& chunk = *((STG::TChunk<char>*) achunk);
+   if (uState == SGood && (size_t) (pcEnd - pcCurrent) >= chunk.length
+         && memcmp(pcCurrent, chunk.string, chunk.length) == 0) {
+      pcCurrent += chunk.length;
+      return *this;
+   };
+   for (size_t charIndex = 0; charIndex < chunk.length; ++charIndex)
+      assume(chunk.string[charIndex]);
+   return *this;
+}
+
+STG::IOObject::ISBase&
+IOObject::ISBuffer::assume(const STG::VirtualStringProperty& text) {
+   AssumeValidity(*this)
+   text.setToFirstChunk();
+   STG::TChunk<char>* chunk = (STG::TChunk<char>*) text.getChunk();
+   int textLength = text.length();
+   size_t chunkIndex = 0;
+   for (int index =0; index < textLength; ++index) {
+      char chRead = (char) get();
+      if (uState != SGood)
+         throw STG::EReadError();
+      if (chunkIndex == chunk->length) {
+         do {
+            bool isValid = text.setToNextChunk();
+            AssumeCondition(isValid)
+            chunk = (STG::TChunk<char>*) text.getChunk();
+            chunkIndex = 0;
+         } while (chunk->length == 0);
+      };
+      if (chRead != chunk->string[chunkIndex++])
+         throw STG::EReadError();
+   };
+   return *this;
+}
+
+STG::IOObject::ISBase&
+IOObject::ISBuffer::ignore(int n) {
+   AssumeValidity(*this)
+   if (uState != SGood) {
+      uState |= SFail;
+      uLastCount = 0;
+      return *this;
+   };
+   uLastCount = (pcEnd - pcCurrent < n) ? (int) (pcEnd - pcCurrent) : n;
+   pcCurrent += uLastCount;
+   if (uLastCount < n)
+      uState |= SEof;
+   return *this;
+}
+
+#define DefineBufferRead(n, base)                        \
+   AssumeValidity(*this)                                 \
+   if (isRaw)                                            \
+      readRaw(&n, sizeof(n));                            \
+   else                                                  \
+      readInteger(n, base);                              \
+   return *this;
+
+STG::IOObject::ISBase&
+IOObject::ISBuffer::read(int& n, bool isRaw) { DefineBufferRead(n, 10) }
+
+STG::IOObject::ISBase&
+IOObject::ISBuffer::readHexa(int& n) { AssumeValidity(*this) readInteger(n, 16); return *this; }
+
+STG::IOObject::ISBase&
+IOObject::ISBuffer::read(unsigned int& n, bool isRaw) { DefineBufferRead(n, 10) }
+
+STG::IOObject::ISBase&
+IOObject::ISBuffer::readHexa(unsigned int& n) { AssumeValidity(*this) readInteger(n, 16); return *this; }
+
+STG::IOObject::ISBase&
+IOObject::ISBuffer::read(long int& n, bool isRaw) { DefineBufferRead(n, 10) }
+
+STG::IOObject::ISBase&
+IOObject::ISBuffer::readHexa(long int& n) { AssumeValidity(*this) readInteger(n, 16); return *this; }
+
+STG::IOObject::ISBase&
+IOObject::ISBuffer::read(unsigned long int& n, bool isRaw) { DefineBufferRead(n, 10) }
+
+STG::IOObject::ISBase&
+IOObject::ISBuffer::readHexa(unsigned long int& n) { AssumeValidity(*this) readInteger(n, 16); return *this; }
+
+#undef DefineBufferRead
+
+STG::IOObject::ISBase&
+IOObject::ISBuffer::read(double& f, bool isRaw) {
+   AssumeValidity(*this)
+   if (isRaw) {
+      readRaw(&f, sizeof(f));
+      return *this;
+   };
+   if (!skipSpaces())
+      return *this;
+   const char* start = pcCurrent;
+   if (*start == '+' && pcEnd - start > 1 && (isdigit((unsigned char) start[1]) || start[1] == '.'))
+      ++start;
+   std::from_chars_result result = std::from_chars(start, pcEnd, f);
+   if (result.ec == std::errc::invalid_argument) {
+      f = 0;
+      uState |= SFail;
+      return *this;
+   };
+   pcCurrent = result.ptr;
+   if (pcCurrent == pcEnd)
+      uState |= SEof;
+   if (result.ec == std::errc::result_out_of_range) {
+      // same result as strtod for the overflows, but the underflows go to 0
+      const char* exponent = start;
+      while (exponent < pcCurrent && *exponent != 'e' && *exponent != 'E')
+         ++exponent;
+      bool isUnderflow = exponent < pcCurrent-1 && exponent[1] == '-';
+      f = isUnderflow ? 0.0 : HUGE_VAL;
+      if (*start == '-')
+         f = -f;
+      uState |= SFail;
+   };
+   return *this;
+}
+
+STG::IOObject::ISBase&
+IOObject::ISBuffer::readchunk(void* achunk) {
+   AssumeValidity(*this)
+   STG::TChunk<char>& chunk = *((STG::TChunk<char>*) achunk);
+   if (uState != SGood) {
+      uState |= SFail;
+      chunk.length = uLastCount = 0;
+      return *this;
+   };
+   size_t length = chunk.length;
+   if ((size_t) (pcEnd - pcCurrent) < length) {
+      length = (size_t) (pcEnd - pcCurrent);
+      uState |= SEof | SFail;
+   };
+   memcpy(chunk.string, pcCurrent, length);
+   pcCurrent += length;
+   chunk.length = length;
+   uLastCount = (int) length;
+   return *this;
+}
+
+STG::IOObject::ISBase&
+IOObject::ISBuffer::read(const STG::VirtualStringProperty& source, bool isRaw) {
+   AssumeValidity(*this)
+   int length = 0;
+   if (isRaw)
+      readRaw(&length, sizeof(length));
+   else {
+      readInteger(length, 10);
+      if (get() != ' ')
+         throw STG::EReadError();
+   }
+   if (uState != SGood) throw STG::EReadError();
+   readsome(source, length);
+   return *this;
+}
+
+STG::IOObject::ISBase&
+IOObject::ISBuffer::readall(const STG::VirtualStringProperty& source) {
+   AssumeValidity(*this)
+   MemoryStreamBuffer buffer(pcCurrent, pcEnd);
+   std::istream in(&buffer);
+   source.readall(&in);
+   pcCurrent = buffer.current();
+   if (in.eof())
+      uState |= SEof;
+   return *this;
+}
+
+STG::IOObject::ISBase&
+IOObject::ISBuffer::read(const STG::VirtualStringProperty& source, int n, bool) {
+   AssumeValidity(*this)
+   if (readsome(source, n) != n)
+      throw STG::EReadError();
+   return *this;
+}
+
+   /* class OSBuffer */
+
+void
+IOObject::OSBuffer::emptyBuffer() {
+   AssumeCondition(posTarget)
+   posTarget->write(sBuffer.c_str(), sBuffer.length());
+   uFlushedLength += sBuffer.length();
+   sBuffer.clear();
+}
+
+STG::IOObject::OSBase&
+IOObject::OSBuffer::seekp(int pos) {
+   AssumeCondition(pos >= 0 && (size_t) pos >= uFlushedLength
+         && (size_t) pos <= uFlushedLength + sBuffer.length())
+   sBuffer.resize(pos - uFlushedLength);
+   return *this;
+}
+
+STG::IOObject::OSBase&
+IOObject::OSBuffer::seekp(int pos, int origin) {
+   return seekp((origin == std::ios_base::beg) ? pos : (tellp() + pos));
+}
+
+#define DefineBufferWrite(n, base)                          \
+   if (isRaw)                                               \
+      appendRaw(&n, sizeof(n));                             \
+   else {                                                   \
+      char buffer[24];                                      \
+      std::to_chars_result result = std::to_chars(buffer,   \
+            buffer + sizeof(buffer), n, base);              \
+      sBuffer.append(buffer, result.ptr - buffer);          \
+      checkThreshold();                                     \
+   };                                                       \
+   return *this;
+
+STG::IOObject::OSBase&
+IOObject::OSBuffer::write(int n, bool isRaw) { DefineBufferWrite(n, 10) }
+
+STG::IOObject::OSBase&
+IOObject::OSBuffer::writeHexa(int n) { bool isRaw = false; unsigned int u = n; DefineBufferWrite(u, 16) }
+
+STG::IOObject::OSBase&
+IOObject::OSBuffer::write(unsigned int n, bool isRaw) { DefineBufferWrite(n, 10) }
+
+STG::IOObject::OSBase&
+IOObject::OSBuffer::writeHexa(unsigned int n) { bool isRaw = false; DefineBufferWrite(n, 16) }
+
+STG::IOObject::OSBase&
+IOObject::OSBuffer::write(long int n, bool isRaw) { DefineBufferWrite(n, 10) }
+
+STG::IOObject::OSBase&
+IOObject::OSBuffer::writeHexa(long int n) { bool isRaw = false; unsigned long int u = n; DefineBufferWrite(u, 16) }
+
+STG::IOObject::OSBase&
+IOObject::OSBuffer::write(unsigned long int n, bool isRaw) { DefineBufferWrite(n, 10) }
+
+STG::IOObject::OSBase&
+IOObject::OSBuffer::writeHexa(unsigned long int n) { bool isRaw = false; DefineBufferWrite(n, 16) }
+
+#undef DefineBufferWrite
+
+STG::IOObject::OSBase&
+IOObject::OSBuffer::write(double f, bool isRaw) {
+   if (isRaw)
+      appendRaw(&f, sizeof(f));
+   else {
+      // same output as std::ostream with its default precision
+      char buffer[32];
+      std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), f,
+            std::chars_format::general, 6);
+      sBuffer.append(buffer, result.ptr - buffer);
+      checkThreshold();
+   };
+   return *this;
+}
+
+STG::IOObject::OSBase&
+IOObject::OSBuffer::write(const STG::VirtualStringProperty& source, bool isRaw) {
+   int length = source.length();
+   if (isRaw)
+      appendRaw(&length, sizeof(length));
+   else {
+      write(length, false);
+      sBuffer.push_back(' ');
+   };
+   if (source.setToFirstChunk()) {
+      do {
+         STG::TChunk<char>* chunk = (STG::TChunk<char>*) source.getChunk();
+         sBuffer.append(chunk->string, chunk->length);
+      } while (source.setToNextChunk());
+   };
+   checkThreshold();
+   return *this;
+}
+
+STG::IOObject::OSBase&
+IOObject::OSBuffer::writeall(const STG::VirtualStringProperty& source) {
+   std::ostringstream out;
+   source.write(&out);
+   sBuffer += out.str();
+   checkThreshold();
+   return *this;
+}
+
+STG::IOObject::OSBase&
+IOObject::OSBuffer::flush() {
+   if (posTarget) {
+      emptyBuffer();
+      posTarget->flush();
+   };
+   return *this;
+}
+
 const char*
 IOObject::debugWrite() const {
    static std::string result;
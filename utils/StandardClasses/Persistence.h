@@ -32,6 +32,9 @@
 
 #include "StandardClasses/StandardClasses.hpp"
 #include <cstring>
+#include <cstdio>
+#include <cctype>
+#include <string>
 
 namespace STG {
 
@@ -335,6 +338,197 @@ class IOObject : public EnhancedObject {
       #undef DefineDeclareOMethods
    };
 
+   /* ISBuffer parses directly from a memory block that it owns or that it only views.
+      The character methods are inline and the numbers are parsed without any std::istream,
+      but the states good/eof/fail follow the ones of std::istream. */
+   class ISBuffer : public ISBase {
+     public:
+      enum State { SGood = 0, SEof = 1, SFail = 2 };
+
+     private:
+      std::string sContent;
+      const char* pcBegin;
+      const char* pcCurrent;
+      const char* pcEnd;
+      int uState;
+      int uLastCount;
+
+      bool skipSpaces();
+      template <typename TypeInteger> void readInteger(TypeInteger& n, int base);
+      void readRaw(void* value, int size);
+
+     public:
+      ISBuffer() : pcBegin(nullptr), pcCurrent(nullptr), pcEnd(nullptr), uState(SGood), uLastCount(0) {}
+      ISBuffer(const char* begin, const char* end)
+         :  pcBegin(begin), pcCurrent(begin), pcEnd(end), uState(SGood), uLastCount(0) {}
+      ISBuffer(const ISBuffer& source) = delete;
+
+      bool isValid() const { return pcCurrent >= pcBegin && pcCurrent <= pcEnd; }
+      virtual bool isStringBased() const override { return true; }
+      void setView(const char* begin, const char* end)
+         {  sContent.clear();
+            pcBegin = pcCurrent = begin; pcEnd = end;
+            uState = SGood; uLastCount = 0;
+         }
+      void setContent(std::string&& content)
+         {  sContent = std::move(content);
+            pcBegin = pcCurrent = sContent.c_str(); pcEnd = pcBegin + sContent.length();
+            uState = SGood; uLastCount = 0;
+         }
+      void setContent(const char* content) { setContent(std::string(content)); }
+      bool loadFile(const char* fileName);
+      void clear() { uState = SGood; }
+      void setFail() { uState |= SFail; }
+      const char* current() const { return pcCurrent; }
+      const char* end() const { return pcEnd; }
+
+      virtual int gcount() override { return uLastCount; }
+      virtual int get() override final
+         {  if (uState != SGood) { uState |= SFail; uLastCount = 0; return EOF; }
+            if (pcCurrent == pcEnd) { uState = SEof | SFail; uLastCount = 0; return EOF; }
+            uLastCount = 1;
+            return (unsigned char) *pcCurrent++;
+         }
+      virtual ISBase& get(char& ch) override final
+         {  int result = get();
+            if (result != EOF) ch = (char) result;
+            return *this;
+         }
+      virtual int peek() override final
+         {  if (uState != SGood) { uState |= SFail; return EOF; }
+            if (pcCurrent == pcEnd) { uState |= SEof; return EOF; }
+            return (unsigned char) *pcCurrent;
+         }
+      virtual int readsome(const STG::VirtualStringProperty& source, int n) override;
+      virtual ISBase& unget() override final
+         {  uState &= ~SEof;
+            if (uState == SGood) {
+               if (pcCurrent > pcBegin) --pcCurrent;
+               else uState |= SFail;
+            };
+            return *this;
+         }
+      virtual ISBase& ignorespaces() override final
+         {  int ch;
+            while ((ch = peek()) != EOF && isspace(ch)) ++pcCurrent;
+            return *this;
+         }
+      virtual bool canread() override final { return peek() >= 0; }
+      virtual bool good() override final { return uState == SGood; }
+      bool eof() const { return uState & SEof; }
+      bool fail() const { return uState & SFail; }
+      virtual int tellg() override { return (uState & SFail) ? -1 : (int) (pcCurrent - pcBegin); }
+      virtual ISBase& seekg(int pos) override;
+      virtual ISBase& seekg(int pos, int origin) override;
+
+      virtual ISBase& assume(char ch) override final
+         {  char chRead = (char) get();
+            if (uState != SGood || (chRead != ch)) {
+               if (uState == SGood)
+                  unget();
+               throw STG::EReadError();
+            };
+            return *this;
+         }
+      virtual ISBase& assume(void* chunk) override;
+      virtual ISBase& assume(const STG::VirtualStringProperty& text) override;
+      virtual ISBase& ignore(int n) override;
+      virtual ISBase& read(char& ch, bool /* isRaw */) override final
+         {  get(ch);
+            if (uState != SGood) throw STG::EReadError();
+            return *this;
+         }
+      virtual ISBase& read(bool& b, bool isRaw) override final
+         {  char ch = (char) get();
+            if (uState != SGood) throw STG::EReadError();
+            b = isRaw ? (bool) ch : (bool) (ch - '0');
+            return *this;
+         }
+      virtual ISBase& read(int& n, bool isRaw) override;
+      virtual ISBase& readHexa(int& n) override;
+      virtual ISBase& read(unsigned int& n, bool isRaw) override;
+      virtual ISBase& readHexa(unsigned int& n) override;
+      virtual ISBase& read(long int& n, bool isRaw) override;
+      virtual ISBase& readHexa(long int& n) override;
+      virtual ISBase& read(unsigned long int& n, bool isRaw) override;
+      virtual ISBase& readHexa(unsigned long int& n) override;
+      virtual ISBase& read(double& f, bool isRaw) override;
+      virtual ISBase& readchunk(void* chunk) override;
+      virtual ISBase& read(const STG::VirtualStringProperty& source, bool isRaw) override;
+      virtual ISBase& read(const STG::VirtualStringProperty& source, int n, bool isRaw) override;
+      virtual ISBase& readall(const STG::VirtualStringProperty& source) override;
+   };
+
+   /* OSBuffer formats into a memory block. With a target stream, the block is emptied
+      into the target when it goes beyond the flush threshold and on flush(). */
+   class OSBuffer : public OSBase {
+     private:
+      std::string sBuffer;
+      std::ostream* posTarget;
+      size_t uFlushThreshold;
+      size_t uFlushedLength;
+
+      void appendRaw(const void* value, size_t size)
+         {  sBuffer.append((const char*) value, size); checkThreshold(); }
+
+     protected:
+      void checkThreshold()
+         {  if (posTarget && sBuffer.length() >= uFlushThreshold)
+               emptyBuffer();
+         }
+      void emptyBuffer();
+
+     public:
+      OSBuffer() : posTarget(nullptr), uFlushThreshold(1 << 16), uFlushedLength(0) {}
+      OSBuffer(std::ostream& target, size_t flushThreshold = 1 << 16)
+         :  posTarget(&target), uFlushThreshold(flushThreshold), uFlushedLength(0)
+         {  sBuffer.reserve(flushThreshold + 64); }
+      OSBuffer(const OSBuffer& source) = delete;
+      virtual ~OSBuffer() { if (posTarget) emptyBuffer(); }
+
+      bool isValid() const { return true; }
+      virtual bool isStringBased() const override { return !posTarget; }
+      void setTarget(std::ostream* target, size_t flushThreshold = 1 << 16)
+         {  if (posTarget) emptyBuffer();
+            posTarget = target;
+            uFlushThreshold = flushThreshold;
+            if (posTarget) sBuffer.reserve(flushThreshold + 64);
+         }
+      void clear() { sBuffer.clear(); }
+      const std::string& buffer() const { return sBuffer; }
+      std::string content() const { return sBuffer; }
+      const char* scontent() const { return sBuffer.c_str(); }
+
+      virtual OSBase& put(char c) override final
+         {  sBuffer.push_back(c); checkThreshold(); return *this; }
+      virtual int tellp() override { return (int) (uFlushedLength + sBuffer.length()); }
+      virtual OSBase& seekp(int pos) override;
+      virtual OSBase& seekp(int pos, int origin) override;
+      virtual void assumealloc(int incsize) override { sBuffer.reserve(sBuffer.length() + incsize); }
+
+      virtual OSBase& write(char ch, bool /* isRaw */) override final { return put(ch); }
+      virtual OSBase& write(int n, bool isRaw) override;
+      virtual OSBase& writeHexa(int n) override;
+      virtual OSBase& write(unsigned int n, bool isRaw) override;
+      virtual OSBase& writeHexa(unsigned int n) override;
+      virtual OSBase& write(long int n, bool isRaw) override;
+      virtual OSBase& writeHexa(long int n) override;
+      virtual OSBase& write(unsigned long int n, bool isRaw) override;
+      virtual OSBase& writeHexa(unsigned long int n) override;
+      virtual OSBase& write(double f, bool isRaw) override;
+      virtual OSBase& write(bool b, bool isRaw) override final
+         {  return put(isRaw ? (char) b : (b ? '1' : '0')); }
+      virtual OSBase& writechunk(void* achunk) override final
+         {  const STG::TChunk<char>& chunk = *((const STG::TChunk<char>*) achunk);
+            sBuffer.append(chunk.string, chunk.length);
+            checkThreshold();
+            return *this;
+         }
+      virtual OSBase& write(const STG::VirtualStringProperty& source, bool isRaw) override;
+      virtual OSBase& writeall(const STG::VirtualStringProperty& source) override;
+      virtual OSBase& flush() override;
+   };
+
   protected:
    virtual void _read(ISBase& /* in */, const FormatParameters& /* params */) {}
    virtual void _write(OSBase& /* out */, const FormatParameters& /* params */) const {}